@@ -0,0 +1,62 @@
+#!/usr/bin/env sh
+
+# Writes a synthetic, documented C++ project of the given size, along with
+# a Doxyfile which builds it with the doxyYoda header, footer, layout and
+# stylesheet from this checkout, or from the one in $DOXYYODA_THEME.
+# Usage: genProject.sh <dir> [namespaces] [classes] [members] [lines]
+# where classes are per namespace, members per class and lines of extra
+# inline source per member.
+dir=${1:?"Usage: $0 <dir> [namespaces] [classes] [members] [lines]"}
+namespaces=${2:-10}
+classes=${3:-20}
+members=${4:-15}
+lines=${5:-4}
+theme=${DOXYYODA_THEME:-$(cd "$(dirname "$0")/.." && pwd)}
+mkdir -p "$dir/src"
+
+awk -v dir="$dir/src" -v namespaces="$namespaces" -v classes="$classes" \
+    -v members="$members" -v lines="$lines" '
+  BEGIN {
+    for (n = 1; n <= namespaces; n++) {
+      ns = "space" n
+      file = dir "/" ns ".hpp"
+      printf "#pragma once\n#include <vector>\n\n" > file
+      printf "/// Namespace number %d, with $\\sum_{i=1}^{%d} i$ in it.\nnamespace %s {\n\n", n, n, ns > file
+      for (c = 1; c <= classes; c++) {
+        cls = "Widget" c
+        printf "/**\n * @brief Brief for %s::%s.\n *\n", ns, cls > file
+        printf " * A longer description of %s, which refers to\n * space%d::Widget%d.\n *\n", cls, n, (c % classes) + 1 > file
+        printf " * @note Generated by bench/genProject.sh\n */\n" > file
+        base = c > 1 ? " : public Widget" (c - 1) : ""
+        printf "class %s%s {\npublic:\n", cls, base > file
+        for (m = 1; m <= members; m++) {
+          printf "  /// @brief Member %d of %s.\n", m, cls > file
+          printf "  /// @param x the input\n  /// @return the result\n" > file
+          printf "  template <typename T>\n  std::vector<T> member%d(const T &x) const {\n", m > file
+          printf "    std::vector<T> out;\n" > file
+          for (l = 1; l <= lines; l++) printf "    out.push_back(x); // line %d\n", l > file
+          printf "    return out;\n  }\n" > file
+        }
+        printf "\nprivate:\n  int state_%d = %d; ///< Some state.\n};\n\n", c, c > file
+        printf "/// Free function for %s.\ninline int make%s(int n) { return n + %d; }\n\n", cls, cls, c > file
+      }
+      printf "} // namespace %s\n", ns > file
+      close(file)
+    }
+  }
+'
+
+cat > "$dir/Doxyfile" <<DOXY
+PROJECT_NAME           = "Bench"
+INPUT                  = src
+RECURSIVE              = YES
+EXTRACT_ALL            = YES
+SOURCE_BROWSER         = YES
+INLINE_SOURCES         = YES
+GENERATE_LATEX         = NO
+HTML_HEADER            = "$theme/src/html/header.html"
+HTML_FOOTER            = "$theme/src/html/footer.html"
+HTML_EXTRA_STYLESHEET  = "$theme/src/styles/doxyYoda.css"
+LAYOUT_FILE            = "$theme/src/xml/doxyYoda.xml"
+DOXY
+echo "Wrote $namespaces namespaces of $classes classes with $members members to $dir"
@@ -0,0 +1,150 @@
+#!/usr/bin/env sh
+
+# Measures a generated site per kind of page: bytes and element counts,
+# and the selectors of the stylesheet which can apply to it (those whose
+# key compound only names tags, ids and classes the kind's pages have),
+# how many compounds they have and how many simple selectors, as tab
+# separated "metric value" lines.
+# Usage: measure.sh <html dir> <stylesheet>
+html=${1:?"Usage: $0 <html dir> <stylesheet>"}
+css=${2:?"Usage: $0 <html dir> <stylesheet>"}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+find "$html" -name '*.html' | while IFS= read -r page; do
+  case $(basename "$page") in
+    class*-members.html) kind=members ;;
+    annotated.html | classes.html | hierarchy.html) kind=classindex ;;
+    class*|struct*|union*) kind=class ;;
+    namespaces.html | namespacemembers*.html) kind=namespaceindex ;;
+    namespace*) kind=namespace ;;
+    *_source.html) kind=source ;;
+    *_8*) kind=file ;;
+    functions*|globals*) kind=memberindex ;;
+    dir_*) kind=dir ;;
+    *) kind=other ;;
+  esac
+  printf '%s\t%s\n' "$kind" "$page"
+done > "$tmp/pages"
+
+while IFS="$(printf '\t')" read -r kind page; do
+  printf '%s\t%s\t%s\n' "$kind" "$(wc -c < "$page")" "$(grep -o '<[a-zA-Z]' "$page" | wc -l)"
+done < "$tmp/pages" | awk -F '\t' '
+  { pages[$1]++; bytes[$1] += $2; nodes[$1] += $3 }
+  END {
+    for (kind in pages) {
+      printf "%s.pages\t%d\n", kind, pages[kind]
+      printf "%s.bytes\t%d\n", kind, bytes[kind] / pages[kind]
+      printf "%s.nodes\t%d\n", kind, nodes[kind] / pages[kind]
+    }
+  }
+' > "$tmp/weight"
+
+# Comments out, then one selector per line
+sed 's|/\*[^*]*\*\+\([^/*][^*]*\*\+\)*/||g' "$css" | tr '\n' ' ' | tr '}' '\n' | awk -F '{' '
+  NF < 2 { next }
+  {
+    list = $(NF - 1)
+    sub(/.*;/, "", list)
+    gsub(/^[ \t]+|[ \t]+$/, "", list)
+    if (list == "" || list ~ /^@/ || list ~ /^[0-9.]+%$|^from$|^to$/) next
+    rules++
+    n = split(list, selector, ",")
+    for (i = 1; i <= n; i++) {
+      gsub(/^[ \t]+|[ \t]+$/, "", selector[i])
+      if (selector[i] != "") print selector[i]
+    }
+  }
+  END {
+    printf "css.bytes\t%d\n", bytes > "/dev/stderr"
+    printf "css.rules\t%d\n", rules > "/dev/stderr"
+  }
+' bytes="$(wc -c < "$css")" > "$tmp/selectors" 2> "$tmp/css"
+
+# The tags, ids and classes each kind of page has
+while IFS="$(printf '\t')" read -r kind page; do
+  grep -o '<[a-zA-Z][a-zA-Z0-9]*\|id="[^"]*"\|class="[^"]*"' "$page" | sed "s/^/$kind	/"
+done < "$tmp/pages" | awk -F '\t' '
+  NR == FNR { order[++selectors] = $0; next }
+  {
+    t = $2
+    if (t ~ /^</) have[$1, tolower(substr(t, 2))] = 1
+    else if (t ~ /^id=/) have[$1, "#" substr(t, 5, length(t) - 5)] = 1
+    else {
+      n = split(substr(t, 8, length(t) - 8), c, /[ \t]+/)
+      for (i = 1; i <= n; i++) if (c[i] != "") have[$1, "." c[i]] = 1
+    }
+    kinds[$1] = 1
+  }
+
+  # Splits a selector into its compounds at the combinators outside
+  # brackets and parentheses, returns how many
+  function compounds(s, part,    n, i, c, nest, cur) {
+    n = 0
+    cur = ""
+    nest = 0
+    for (i = 1; i <= length(s); i++) {
+      c = substr(s, i, 1)
+      if (c == "[" || c == "(") nest++
+      else if (c == "]" || c == ")") nest--
+      if (!nest && (c == " " || c == "\t" || c == ">" || c == "+" || c == "~")) {
+        if (cur != "") part[++n] = cur
+        cur = ""
+      } else cur = cur c
+    }
+    if (cur != "") part[++n] = cur
+    return n
+  }
+
+  # Simple selectors of a compound: its tag and every class, id, pseudo
+  # class or element and attribute
+  function simple(compound,    t, n) {
+    t = compound
+    gsub(/\[[^]]*\]/, "[", t)
+    gsub(/\([^)]*\)/, "", t)
+    gsub(/::/, ":", t)
+    n = gsub(/[.#:\[]/, "&", t)
+    return n + (t ~ /^[a-zA-Z*]/)
+  }
+
+  # The tag, ids and classes of the key compound, space separated
+  function keys(compound,    t, list) {
+    t = compound
+    gsub(/\[[^]]*\]/, "", t)
+    gsub(/:[^.#:]*(\([^)]*\))?/, "", t)
+    list = ""
+    if (match(t, /^[a-zA-Z][a-zA-Z0-9]*/)) list = tolower(substr(t, 1, RLENGTH))
+    while (match(t, /[.#][^.#]+/)) {
+      list = list " " substr(t, RSTART, RLENGTH)
+      t = substr(t, RSTART + RLENGTH)
+    }
+    return list
+  }
+
+  END {
+    for (i = 1; i <= selectors; i++) {
+      n = compounds(order[i], part)
+      depth[i] = n
+      count[i] = 0
+      for (j = 1; j <= n; j++) count[i] += simple(part[j])
+      key[i] = keys(part[n])
+    }
+    for (kind in kinds) {
+      applies = sumDepth = sumSimple = 0
+      for (i = 1; i <= selectors; i++) {
+        m = split(key[i], k, " ")
+        for (j = 1; j <= m; j++) if (!((kind, k[j]) in have)) break
+        if (j <= m) continue
+        applies++
+        sumDepth += depth[i]
+        sumSimple += count[i]
+      }
+      printf "%s.selectors\t%d\n", kind, applies
+      printf "%s.depth\t%.2f\n", kind, applies ? sumDepth / applies : 0
+      printf "%s.simple\t%.2f\n", kind, applies ? sumSimple / applies : 0
+    }
+  }
+' "$tmp/selectors" - > "$tmp/complexity"
+printf 'css.selectors\t%d\n' "$(wc -l < "$tmp/selectors")" >> "$tmp/css"
+
+sort "$tmp/weight" "$tmp/complexity" "$tmp/css"
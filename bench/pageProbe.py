@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+# Copyright 2020 Rohit Goswami <rog32@hi.is>
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Loads a page in headless Chromium and prints what bench/perfProbe.js
+reports for it.
+
+The browser is driven over the DevTools protocol on --remote-debugging-pipe
+(NUL terminated JSON on file descriptors 3 and 4), so no websocket client
+is needed. The page runs on the real clock: once its load event has fired,
+the #perf-probe element is waited for with a polling promise, up to the
+timeout.
+
+Usage: pageProbe.py <chrome> <url> [timeout seconds]
+"""
+
+import fcntl
+import json
+import os
+import select
+import subprocess
+import sys
+import time
+
+PROBE = """new Promise(function (resolve) {
+  (function poll() {
+    var out = document.getElementById("perf-probe");
+    out ? resolve(out.textContent) : setTimeout(poll, 50);
+  })();
+})"""
+
+
+class Browser:
+    def __init__(self, chrome, deadline):
+        commands, self.commands = os.pipe()
+        self.results, results = os.pipe()
+
+        # Moved clear of 3 and 4 first, either end may have been given one
+        def pipes():
+            high = [fcntl.fcntl(fd, fcntl.F_DUPFD, 5) for fd in (commands, results)]
+            for fd, to in zip(high, (3, 4)):
+                os.dup2(fd, to)
+
+        self.process = subprocess.Popen(
+            [chrome, "--headless=new", "--disable-gpu", "--no-sandbox",
+             "--enable-precise-memory-info", "--remote-debugging-pipe",
+             "about:blank"],
+            stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL,
+            close_fds=False, preexec_fn=pipes)
+        os.close(commands)
+        os.close(results)
+        self.deadline = deadline
+        self.buffer = b""
+        self.events = []
+        self.last = 0
+
+    def read(self):
+        """The next message from the browser"""
+        while b"\0" not in self.buffer:
+            left = self.deadline - time.monotonic()
+            if left <= 0 or not select.select([self.results], [], [], left)[0]:
+                raise TimeoutError
+            chunk = os.read(self.results, 65536)
+            if not chunk:
+                raise EOFError("browser closed the pipe")
+            self.buffer += chunk
+        message, self.buffer = self.buffer.split(b"\0", 1)
+        return json.loads(message)
+
+    def send(self, method, session=None, **params):
+        """Sends a command and returns its result, keeping events for wait"""
+        self.last += 1
+        message = {"id": self.last, "method": method, "params": params}
+        if session:
+            message["sessionId"] = session
+        os.write(self.commands, json.dumps(message).encode() + b"\0")
+        while True:
+            reply = self.read()
+            if reply.get("id") != self.last:
+                self.events.append(reply)
+            elif "error" in reply:
+                raise RuntimeError("%s: %s" % (method, reply["error"]["message"]))
+            else:
+                return reply["result"]
+
+    def wait(self, method, session):
+        """Returns once the session has sent the given event"""
+        while True:
+            event = self.events.pop(0) if self.events else self.read()
+            if event.get("method") == method and event.get("sessionId") == session:
+                return event["params"]
+
+    def close(self):
+        try:
+            self.send("Browser.close")
+        except (OSError, EOFError, TimeoutError, RuntimeError):
+            pass
+        try:
+            self.process.wait(5)
+        except subprocess.TimeoutExpired:
+            self.process.kill()
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit(__doc__.split("Usage: ")[1].strip())
+    timeout = float(sys.argv[3]) if len(sys.argv) > 3 else 60
+    browser = Browser(sys.argv[1], time.monotonic() + timeout)
+    try:
+        target = browser.send("Target.createTarget", url="about:blank")["targetId"]
+        session = browser.send("Target.attachToTarget", targetId=target,
+                               flatten=True)["sessionId"]
+        browser.send("Page.enable", session)
+        browser.send("Page.navigate", session, url=sys.argv[2])
+        browser.wait("Page.loadEventFired", session)
+        result = browser.send("Runtime.evaluate", session, expression=PROBE,
+                              awaitPromise=True, returnByValue=True)
+        print(result["result"]["value"])
+    except TimeoutError:
+        sys.exit("No timings for %s within %gs" % (sys.argv[2], timeout))
+    except (EOFError, OSError) as error:
+        sys.exit("No timings for %s: %s" % (sys.argv[2], error))
+    finally:
+        browser.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,77 @@
+// Copyright 2020 Rohit Goswami <rog32@hi.is>
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Injected into pages by bench/renderTiming.sh. Once the page and the
+// formulas in view have settled it writes its timings into a #perf-probe
+// element, which bench/pageProbe.py waits for and reads.
+(function () {
+  var longTasks = [];
+  if (window.PerformanceObserver) {
+    try {
+      new PerformanceObserver(function (list) {
+        longTasks = longTasks.concat(list.getEntries());
+      }).observe({ type: "longtask", buffered: true });
+    } catch (e) {}
+  }
+
+  // The root font size changes every rem and em length in the theme, so
+  // this times a full style recalculation and layout of the page (a class
+  // nothing selects would be skipped by the style engine)
+  function relayout() {
+    var root = document.documentElement.style, size = root.fontSize, times = [];
+    for (var i = 0; i < 5; i++) {
+      var start = performance.now();
+      root.fontSize = i % 2 ? size : "100.5%";
+      void document.body.offsetHeight;
+      times.push(performance.now() - start);
+    }
+    root.fontSize = size;
+    void document.body.offsetHeight;
+    return times.sort(function (a, b) { return a - b; })[2];
+  }
+
+  function report(mathjax) {
+    var navigation = performance.getEntriesByType("navigation")[0] || {};
+    var paint = performance.getEntriesByName("first-contentful-paint")[0];
+    var result = {
+      fcp: paint ? paint.startTime : -1,
+      domContentLoaded: navigation.domContentLoadedEventEnd || -1,
+      load: navigation.loadEventEnd || -1,
+      mathjax: mathjax,
+      relayout: relayout(),
+      longTasks: longTasks.length,
+      longTaskTime: longTasks.reduce(function (sum, task) { return sum + task.duration; }, 0),
+      heap: performance.memory ? performance.memory.usedJSHeapSize : -1,
+      nodes: document.getElementsByTagName("*").length
+    };
+    var out = document.createElement("pre");
+    out.id = "perf-probe";
+    out.textContent = JSON.stringify(result);
+    document.body.appendChild(out);
+  }
+
+  // The header typesets lazily, after DOMContentLoaded, so mathjax is when
+  // the formulas in view on load were done (from navigation start), 0 on
+  // pages without math and -1 when MathJax failed to load
+  window.addEventListener("load", function () {
+    setTimeout(function () {
+      if (!window.DoxyYodaMath) return report(0);
+      DoxyYodaMath.ready.then(function () {
+        report(performance.now());
+      }, function () {
+        report(-1);
+      });
+    }, 0);
+  });
+})();
@@ -0,0 +1,78 @@
+#!/usr/bin/env sh
+
+# Loads a fixed set of pages from a generated site in headless Chromium and
+# records paint, load, MathJax, relayout, long task and heap numbers for
+# each (the median of several runs), as tab separated values. Pages run
+# on the real clock, bench/pageProbe.py drives the browser over the
+# DevTools protocol until bench/perfProbe.js has reported.
+# The browser is $CHROME, or chromium / google-chrome from the PATH.
+# Usage: renderTiming.sh <html dir> [runs] > timings.tsv
+#        renderTiming.sh --compare <before.tsv> <after.tsv>
+if [ "$1" = "--compare" ]; then
+  awk -F '\t' '
+    NR == FNR { if (FNR == 1) split($0, name); else for (i = 2; i <= NF; i++) base[$1, i] = $i; next }
+    FNR == 1 { next }
+    {
+      for (i = 2; i <= NF; i++) {
+        change = base[$1, i] > 0 ? 100 * ($i - base[$1, i]) / base[$1, i] : 0
+        printf "%-40s %-16s %12.1f %12.1f %+8.1f%%\n", $1, name[i], base[$1, i], $i, change
+      }
+    }
+  ' "$2" "$3"
+  exit
+fi
+
+html=${1:?"Usage: $0 <html dir> [runs]"}
+runs=${2:-5}
+here=$(cd "$(dirname "$0")" && pwd)
+chrome=$CHROME
+for candidate in chromium chromium-browser google-chrome; do
+  [ -n "$chrome" ] && break
+  command -v "$candidate" > /dev/null && chrome=$candidate
+done
+[ -n "$chrome" ] || { echo "No chromium found, set CHROME" >&2; exit 1; }
+
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+cp -r "$html/." "$work"
+cp "$here/perfProbe.js" "$work"
+
+# The front page and the biggest page of each kind
+corpus=$( (echo index.html
+  cd "$work" && for kind in 'class*' 'namespace*' '*_8*' '*_source.html' 'functions*' 'dir_*'; do
+    ls -S $kind 2>/dev/null | grep -v -- '-members' | head -1
+  done) | sort -u)
+for page in $corpus; do
+  sed -i 's|</head>|<script src="perfProbe.js"></script></head>|' "$work/$page"
+done
+
+printf 'page\tfcp\tdomContentLoaded\tload\tmathjax\trelayout\tlongTasks\tlongTaskTime\theap\tnodes\n'
+for page in $corpus; do
+  i=0
+  while [ $i -lt "$runs" ]; do
+    "$here/pageProbe.py" "$chrome" "file://$work/$page" 60
+    i=$((i + 1))
+  done | awk -v page="$page" -v runs="$runs" '
+    {
+      gsub(/[{}"]/, "")
+      n = split($0, field, ",")
+      for (i = 1; i <= n; i++) {
+        split(field[i], pair, ":")
+        value[pair[1], NR] = pair[2]
+        if (NR == 1) key[i] = pair[1]
+      }
+    }
+    function median(k,    i, j, t, v, m) {
+      for (i = 1; i <= NR; i++) v[i] = value[k, i]
+      for (i = 2; i <= NR; i++)
+        for (j = i; j > 1 && v[j - 1] > v[j]; j--) { t = v[j]; v[j] = v[j - 1]; v[j - 1] = t }
+      return v[int((NR + 1) / 2)]
+    }
+    END {
+      if (!NR) { print "No timings for " page > "/dev/stderr"; exit }
+      line = page
+      for (i = 1; i in key; i++) line = line "\t" median(key[i])
+      print line
+    }
+  '
+done
@@ -0,0 +1,38 @@
+#!/usr/bin/env sh
+
+# Builds a synthetic project in a fresh temporary directory twice, with the
+# theme as committed at a revision (HEAD unless given) and with the working
+# tree, and compares the page weight and selectors of the two.
+# Usage: run.sh [--against <revision>] [namespaces] [classes] [members] [lines]
+here=$(cd "$(dirname "$0")" && pwd)
+root=$(cd "$here/.." && pwd)
+rev=HEAD
+if [ "$1" = "--against" ]; then
+  rev=${2:?"Usage: $0 [--against <revision>] [namespaces] [classes] [members] [lines]"}
+  shift 2
+fi
+work=$(mktemp -d "${TMPDIR:-/tmp}/doxyYoda-bench.XXXXXX")
+mkdir "$work/theme"
+git -C "$root" archive "$rev" | tar -x -C "$work/theme" || exit 1
+
+# Builds the project with the theme in $1 under $2 and measures it
+build() {
+  theme=$1
+  dir=$2
+  shift 2
+  sass --no-source-map "$theme/src/styles/scss/main.scss:$theme/src/styles/doxyYoda.css" || exit 1
+  DOXYYODA_THEME=$theme "$here/genProject.sh" "$dir" "$@" || exit 1
+  (cd "$dir" && doxygen Doxyfile > doxygen.log 2>&1) || exit 1
+  "$here/measure.sh" "$dir/html" "$theme/src/styles/doxyYoda.css" > "$dir/results.tsv"
+}
+
+build "$work/theme" "$work/before" "$@"
+build "$root" "$work/after" "$@"
+echo "Sites in $work/before/html ($rev) and $work/after/html"
+awk -F '\t' '
+  NR == FNR { base[$1] = $2; next }
+  {
+    change = base[$1] ? 100 * ($2 - base[$1]) / base[$1] : 0
+    printf "%-24s %12s %12s %+8.1f%%\n", $1, base[$1], $2, change
+  }
+' "$work/before/results.tsv" "$work/after/results.tsv"
@@ -0,0 +1,164 @@
+#!/usr/bin/env sh
+
+# Estimates what each selector of a compiled stylesheet costs to match
+# over a corpus of generated pages. Selectors are bucketed by their key
+# (rightmost) compound the way browsers do it: "checked" counts the
+# elements which land in a selector's bucket, "matched" those whose
+# classes, id and tag fit the whole key compound, and every combinator to
+# the left is charged per match, an average depth for descendant ones.
+# A selector repeated across rules is charged once per rule.
+# Pseudo classes and attribute selectors aren't checked. Flags mark what
+# is worth rewriting: overqualified (a tag on an id or class anywhere in
+# it), deep (three or more compounds) and universal (no key to bucket by).
+# Usage: selectorCost.sh <stylesheet> <html dir> [rows] [depth]
+css=${1:?"Usage: $0 <stylesheet> <html dir> [rows] [depth]"}
+html=${2:?"Usage: $0 <stylesheet> <html dir> [rows] [depth]"}
+rows=${3:-25}
+depth=${4:-8}
+
+sed 's|/\*[^*]*\*\+\([^/*][^*]*\*\+\)*/||g' "$css" | tr '\n' ' ' | tr '}' '\n' | awk -F '{' '
+  NF < 2 { next }
+  {
+    list = $(NF - 1)
+    sub(/.*;/, "", list)
+    if (list ~ /^[ \t]*@/ || list ~ /^[ \t]*([0-9.]+%|from|to)[ \t]*$/) next
+    n = split(list, selector, ",")
+    for (i = 1; i <= n; i++) {
+      gsub(/^[ \t]+|[ \t]+$/, "", selector[i])
+      if (selector[i] != "") print selector[i]
+    }
+  }
+' > "${TMPDIR:-/tmp}/selectors.$$"
+
+find "$html" -name '*.html' -exec cat {} + | awk -v rows="$rows" -v depth="$depth" '
+  # Splits a selector into its compounds at the combinators outside
+  # brackets and parentheses, each combinator going to comb[] after the
+  # compound on its left ("" for a descendant one). Returns how many
+  function split_compounds(s, part, comb,    n, i, c, nest, cur) {
+    n = 0
+    cur = ""
+    nest = 0
+    for (i = 1; i <= length(s); i++) {
+      c = substr(s, i, 1)
+      if (c == "[" || c == "(") nest++
+      else if (c == "]" || c == ")") nest--
+      if (nest || (c != " " && c != "\t" && c != ">" && c != "+" && c != "~")) {
+        cur = cur c
+        continue
+      }
+      if (cur != "") {
+        part[++n] = cur
+        comb[n] = ""
+        cur = ""
+      }
+      if (c != " " && c != "\t") comb[n] = c
+    }
+    if (cur != "") part[++n] = cur
+    return n
+  }
+
+  # Splits the key compound of a selector into its tag, id and classes
+  function parse(s,    key, t, n, i, part, comb, first, over) {
+    n = split_compounds(s, part, comb)
+    combinators[s] = 0
+    # Sibling and child combinators look at one element, descendant ones
+    # at a few ancestors
+    for (i = 1; i < n; i++) combinators[s] += comb[i] == "" ? depth : 1
+    compounds[s] = n
+    key = part[n]
+    gsub(/\[[^]]*\]/, "", key)
+    sub(/:.*/, "", key)
+    tag[s] = ""
+    if (match(key, /^[a-zA-Z][a-zA-Z0-9]*|^\*/)) tag[s] = tolower(substr(key, 1, RLENGTH))
+    if (tag[s] == "*") tag[s] = ""
+    id[s] = ""
+    if (match(key, /#[^.#]+/)) id[s] = substr(key, RSTART + 1, RLENGTH - 1)
+    classes[s] = ""
+    t = key
+    while (match(t, /\.[^.#]+/)) {
+      classes[s] = classes[s] " " substr(t, RSTART + 1, RLENGTH - 1)
+      t = substr(t, RSTART + RLENGTH)
+    }
+    flags[s] = ""
+    for (i = 1; i <= n; i++) {
+      t = part[i]
+      gsub(/\[[^]]*\]|:.*/, "", t)
+      if (t ~ /^[a-zA-Z][a-zA-Z0-9]*[.#]/) over = 1
+    }
+    if (over) flags[s] = flags[s] "overqualified "
+    if (compounds[s] >= 3) flags[s] = flags[s] "deep "
+    if (id[s] == "" && classes[s] == "" && tag[s] == "") flags[s] = flags[s] "universal "
+    # The rarest part goes first for the bucket
+    if (id[s] != "") bucket = "#" id[s]
+    else if (classes[s] != "") { split(classes[s], first, " "); bucket = "." first[1] }
+    else if (tag[s] != "") bucket = tag[s]
+    else bucket = "*"
+    buckets[bucket] = buckets[bucket] SUBSEP s
+  }
+
+  function fits(s, etag, eid, eclass,    n, i, c) {
+    if (tag[s] != "" && tag[s] != etag) return 0
+    if (id[s] != "" && id[s] != eid) return 0
+    n = split(classes[s], c, " ")
+    for (i = 1; i <= n; i++) if (index(" " eclass " ", " " c[i] " ") == 0) return 0
+    return 1
+  }
+
+  function visit(key, etag, eid, eclass,    n, i, list) {
+    if (!(key in buckets)) return
+    n = split(buckets[key], list, SUBSEP)
+    for (i = 2; i <= n; i++) {
+      checked[list[i]]++
+      if (fits(list[i], etag, eid, eclass)) matched[list[i]]++
+    }
+  }
+
+  # Selectors repeated across rules are matched once per rule
+  NR == FNR {
+    if (!($0 in rules)) {
+      parse($0)
+      order[++selectors] = $0
+    }
+    rules[$0]++
+    next
+  }
+
+  {
+    line = $0
+    while (match(line, /<[a-zA-Z][a-zA-Z0-9]*[^>]*>/)) {
+      element = substr(line, RSTART + 1, RLENGTH - 2)
+      line = substr(line, RSTART + RLENGTH)
+      elements++
+      etag = element
+      sub(/[ \t\/].*/, "", etag)
+      etag = tolower(etag)
+      eid = eclass = ""
+      if (match(element, /id="[^"]*"/)) eid = substr(element, RSTART + 4, RLENGTH - 5)
+      if (match(element, /class="[^"]*"/)) eclass = substr(element, RSTART + 7, RLENGTH - 8)
+      visit("*", etag, eid, eclass)
+      visit(etag, etag, eid, eclass)
+      if (eid != "") visit("#" eid, etag, eid, eclass)
+      n = split(eclass, c, /[ \t]+/)
+      for (i = 1; i <= n; i++) if (c[i] != "") visit("." c[i], etag, eid, eclass)
+    }
+  }
+
+  END {
+    for (i = 1; i <= selectors; i++) {
+      s = order[i]
+      work[s] = rules[s] * (checked[s] + matched[s] * combinators[s])
+      total += work[s]
+    }
+    printf "%d elements, %d selectors, %d estimated steps\n\n", elements, selectors, total
+    printf "%10s %8s %8s %5s %6s  %-28s %s\n", "work", "checked", "matched", "rules", "share", "flags", "selector"
+    for (shown = 0; shown < rows && shown < selectors; shown++) {
+      best = ""
+      for (i = 1; i <= selectors; i++)
+        if (!(order[i] in done) && (best == "" || work[order[i]] > work[best])) best = order[i]
+      done[best] = 1
+      printf "%10d %8d %8d %5d %5.1f%%  %-28s %s\n", work[best], checked[best], matched[best], rules[best],
+        total ? 100 * work[best] / total : 0, flags[best], best
+    }
+  }
+' "${TMPDIR:-/tmp}/selectors.$$" -
+rm -f "${TMPDIR:-/tmp}/selectors.$$"
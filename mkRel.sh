@@ -7,7 +7,29 @@ mkdir -p doxyYoda/css
 cp version.txt doxyYoda
 cp -r src/html doxyYoda
 cp -r src/xml doxyYoda
-minify src/styles/doxyYoda.css -o doxyYoda/css/doxyYoda.min.css
+cp -r src/js doxyYoda
+sed "s/@VERSION@/$version/" src/js/doxyYodaSW.js > doxyYoda/js/doxyYodaSW.js
+# The header for sites with doxyYodaSW.js in HTML_EXTRA_FILES, the plain
+# one never asks for it
+awk '/<\/head>/ {
+  print "<script type=\"text/javascript\">"
+  print "if (\"serviceWorker\" in navigator) {"
+  print "     navigator.serviceWorker.register(\"$relpath^doxyYodaSW.js\").catch(function() {});"
+  print "}"
+  print "</script>"
+} { print }' src/html/header.html > doxyYoda/html/headerSW.html
+cp -r src/xslt doxyYoda
+cp -r tools doxyYoda
+# Structural pass first when csso is around: merges repeated selectors,
+# collapses shorthands, drops overridden declarations and joins media queries
+css=src/styles/doxyYoda.css
+if command -v csso > /dev/null; then
+  csso "$css" --force-media-merge --comments none -o doxyYoda/css/doxyYoda.csso.css
+  css=doxyYoda/css/doxyYoda.csso.css
+fi
+minify "$css" -o doxyYoda/css/doxyYoda.min.css
+echo "CSS: $(wc -c < src/styles/doxyYoda.css) -> $(wc -c < "$css") structural -> $(wc -c < doxyYoda/css/doxyYoda.min.css) bytes"
+rm -f doxyYoda/css/doxyYoda.csso.css
 echo "Apache 2 licensed Doxygen theme by Rohit Goswami <https://rgoswami.me>. \n See: https://github.com/HaoZeke/doxyYoda for details" > doxyYoda/README
 tar -czf "doxyYoda_$version.tar.gz" doxyYoda
 rm -rf doxyYoda
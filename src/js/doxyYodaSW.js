@@ -0,0 +1,133 @@
+// Copyright 2020 Rohit Goswami <rog32@hi.is>
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Optional service worker, registered by the release's headerSW.html
+// (see mkRel.sh) and copied next to the pages with HTML_EXTRA_FILES. The
+// theme's and doxygen's scripts, styles and fonts are kept per release;
+// visited pages, and the images and data they load, are served from a
+// cache of the last MAX_PAGES while being refreshed in the background.
+
+// Filled in from version.txt by mkRel.sh
+var VERSION = "@VERSION@";
+var ASSETS = "doxyYoda-assets-" + VERSION;
+var PAGES = "doxyYoda-pages";
+var MAX_PAGES = 500;
+
+var PRECACHE = [
+  "doxyYoda.min.css",
+  "doxyYoda.css",
+  "tabs.css",
+  "jquery.js",
+  "dynsections.js",
+  "menu.js",
+  "menudata.js",
+  "search/search.css",
+  "search/search.js",
+  "search/searchdata.js",
+  "https://cdn.jsdelivr.net/npm/@xz/fonts@1/serve/cascadia-code.min.css",
+  "https://fonts.googleapis.com/css2?family=PT+Sans:ital,wght@0,400;0,700;1,400&family=Vollkorn:ital,wght@0,400..800;1,400..800&display=swap",
+  // With $self-hosted-fonts
+  "Vollkorn.woff2",
+  "Vollkorn-Italic.woff2",
+  "PTSans-Regular.woff2",
+  "PTSans-Bold.woff2",
+  "PTSans-Italic.woff2",
+  "CascadiaCode.woff2"
+];
+
+// Served from the cache whenever they are there, since they never change
+var IMMUTABLE = /^https:\/\/(fonts\.gstatic\.com|fonts\.googleapis\.com|cdn\.jsdelivr\.net)\//;
+
+self.addEventListener("install", function (event) {
+  event.waitUntil(
+    caches.open(ASSETS).then(function (cache) {
+      // Not every site has every file, so one missing doesn't stop the rest
+      return Promise.all(PRECACHE.map(function (url) {
+        return cache.add(url).catch(function () {});
+      }));
+    }).then(function () { return self.skipWaiting(); })
+  );
+});
+
+self.addEventListener("activate", function (event) {
+  event.waitUntil(
+    caches.keys().then(function (keys) {
+      return Promise.all(keys.filter(function (key) {
+        return key.indexOf("doxyYoda-assets-") === 0 && key !== ASSETS;
+      }).map(function (key) { return caches.delete(key); }));
+    }).then(function () { return self.clients.claim(); })
+  );
+});
+
+function trim(cache) {
+  cache.keys().then(function (keys) {
+    keys.slice(0, Math.max(0, keys.length - MAX_PAGES)).forEach(function (key) {
+      cache.delete(key);
+    });
+  });
+}
+
+function staleWhileRevalidate(request, name) {
+  return caches.open(name).then(function (cache) {
+    // A page's query is only read by its scripts (fulltext.html?q=)
+    return cache.match(request, { ignoreSearch: name === PAGES }).then(function (cached) {
+      var fresh = fetch(request).then(function (response) {
+        if (response.ok) {
+          cache.put(request, response.clone()).then(function () {
+            if (name === PAGES) trim(cache);
+          });
+        }
+        return response;
+      });
+      if (cached) {
+        fresh.catch(function () {});
+        return cached;
+      }
+      return fresh;
+    });
+  });
+}
+
+function cacheFirst(request) {
+  return caches.open(ASSETS).then(function (cache) {
+    return cache.match(request).then(function (cached) {
+      return cached || fetch(request).then(function (response) {
+        if (response.ok || response.type === "opaque") cache.put(request, response.clone());
+        return response;
+      });
+    });
+  });
+}
+
+var theme;
+
+self.addEventListener("fetch", function (event) {
+  var request = event.request;
+  if (request.method !== "GET") return;
+  var url = new URL(request.url);
+  theme = theme || PRECACHE.map(function (file) { return new URL(file, self.registration.scope).href; });
+  if (request.mode === "navigate" || /\.html$/.test(url.pathname)) {
+    event.respondWith(staleWhileRevalidate(request, PAGES));
+  } else if (url.origin === location.origin && url.search) {
+    // Cache busted (tools/cssReload.js), straight from the network
+  } else if (theme.indexOf(url.href) >= 0) {
+    // Doxygen's scripts and the search data change with every run
+    event.respondWith(staleWhileRevalidate(request, ASSETS));
+  } else if (url.origin === location.origin) {
+    // Graphs, images and search chunks only matter for the pages kept
+    event.respondWith(staleWhileRevalidate(request, PAGES));
+  } else if (IMMUTABLE.test(request.url)) {
+    event.respondWith(cacheFirst(request));
+  }
+});
@@ -0,0 +1,206 @@
+// Copyright 2020 Rohit Goswami <rog32@hi.is>
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Symbol search across every project merged by tools/mergeSymbols.sh,
+// matched and ranked as in fuzzySearch.js. Only the trigram shards of the
+// query are fetched, and the few symbol chunks holding its best
+// candidates, never a whole project's list.
+var DoxyYodaFederated = (function () {
+  var F = DoxyYodaFuzzy;
+  var script = document.currentScript;
+  var base = script ? script.src.replace(/[^\/]*$/, "") : "federated/";
+  // Symbol chunks fetched per query at most
+  var CHUNKS = 6;
+  var files = {};
+  var shards = {};
+  var chunks = {};
+  var meta;
+
+  function get(name, json) {
+    if (!files[name]) {
+      files[name] = fetch(base + name).then(function (response) {
+        if (!response.ok) throw new Error(name + ": " + response.status);
+        return json ? response.json() : response.text();
+      });
+    }
+    return files[name];
+  }
+
+  // trigram -> rest of its line, postings are only decoded when asked for
+  function shard(n) {
+    if (!shards[n]) {
+      shards[n] = get("grams/" + n + ".txt").then(function (text) {
+        var grams = {};
+        text.split("\n").forEach(function (line) {
+          var space = line.indexOf(" ");
+          if (space > 0) grams[parseInt(line.slice(0, space), 36)] = line.slice(space + 1);
+        });
+        return grams;
+      }, function () { return {}; });
+    }
+    return shards[n];
+  }
+
+  // Must match the hash in tools/mergeSymbols.sh
+  function shardOf(code) {
+    return Math.floor((Math.imul(code, 2654435761) >>> 0) / (4294967296 / meta.shards));
+  }
+
+  function postings(code) {
+    return shard(shardOf(code)).then(function (grams) {
+      var list = [], id = 0;
+      if (grams[code]) {
+        grams[code].split(" ").forEach(function (delta) {
+          id += parseInt(delta, 36);
+          list.push(id);
+        });
+      }
+      return list;
+    });
+  }
+
+  function chunk(n) {
+    if (!chunks[n]) {
+      chunks[n] = get("symbols." + n + ".txt").then(function (text) {
+        return text.split("\n").filter(Boolean).map(function (line) {
+          var field = line.split("\t"), project = meta.projects[+field[2]];
+          return {
+            kind: field[0].charAt(0), prot: +field[0].charAt(1) || 0,
+            name: field[1], lower: field[1].toLowerCase(),
+            url: project.url + field[3], project: project.name
+          };
+        });
+      });
+    }
+    return chunks[n];
+  }
+
+  // Chunks whose sort keys (kind group and last name component) may start
+  // with the key
+  function prefixed(key) {
+    var low = 0, high = meta.heads.length - 1, found = [];
+    while (low < high) {
+      var mid = (low + high + 1) >> 1;
+      if (meta.heads[mid] < key) low = mid;
+      else high = mid - 1;
+    }
+    for (var n = low; n < meta.heads.length && found.length < CHUNKS; n++) {
+      if (n > low && meta.heads[n].lastIndexOf(key, 0) !== 0) break;
+      found.push(n);
+    }
+    return found;
+  }
+
+  // Names sharing enough of the query's trigrams, by symbol number, and
+  // the chunks holding the best of them. The lists are the postings of
+  // trigrams some name has, spare how many of them typos may spoil.
+  function candidates(lists, spare) {
+    lists.sort(function (a, b) { return a.length - b.length; });
+    var kept = lists.filter(function (list, i) {
+      return i <= spare || list.length <= meta.symbols >> 3;
+    });
+    var need = Math.max(1, kept.length - spare);
+    var hits = new Map();
+    kept.forEach(function (list) {
+      list.forEach(function (id) { hits.set(id, (hits.get(id) || 0) + 1); });
+    });
+    // Chunks by their best overlap, then classes before namespaces before
+    // members, then by how many names have it
+    var best = new Map();
+    hits.forEach(function (count, id) {
+      if (count < need) return;
+      var n = Math.floor(id / meta.chunk), seen = best.get(n);
+      if (!seen || count > seen.count) best.set(n, { count: count, names: 1 });
+      else if (count === seen.count) seen.names++;
+    });
+    var picked = Array.from(best.keys()).sort(function (a, b) {
+      return best.get(b).count - best.get(a).count || meta.heads[a].charAt(0) - meta.heads[b].charAt(0) ||
+        best.get(b).names - best.get(a).names;
+    }).slice(0, CHUNKS);
+    var ids = {};
+    hits.forEach(function (count, id) {
+      if (count >= need && picked.indexOf(Math.floor(id / meta.chunk)) >= 0) ids[id] = true;
+    });
+    return { chunks: picked, ids: ids };
+  }
+
+  // Resolves to the best `limit` matches as { symbol, score }
+  function search(query, limit) {
+    limit = limit || 50;
+    query = query.trim().toLowerCase();
+    if (!query) return Promise.resolve([]);
+    return get("meta.json", true).then(function (m) {
+      meta = m;
+      if (query.length < 3) {
+        var picked = [];
+        ["0", "1", "2"].forEach(function (group) {
+          prefixed(group + query).forEach(function (n) {
+            if (picked.indexOf(n) < 0 && picked.length < CHUNKS) picked.push(n);
+          });
+        });
+        return Promise.all(picked.map(chunk)).then(function (lists) {
+          var results = [];
+          lists.forEach(function (symbols) {
+            symbols.forEach(function (symbol) {
+              var at = symbol.lower.lastIndexOf("::") + 2;
+              if (symbol.lower.indexOf(query, at) === at) {
+                results.push({ symbol: symbol, score: F.rank(symbol, 0, symbol.lower.length) });
+              }
+            });
+          });
+          return results;
+        });
+      }
+      // Trigrams most names have (the namespace, say) are only fetched
+      // when the others are too few to get past the typos. Those no name
+      // has are spoilt for sure and leave fewer for the rest.
+      var grams = F.trigrams(query), max = F.tolerance(query.length);
+      var common = grams.filter(function (code) { return meta.common.indexOf(code) >= 0; });
+      var rare = grams.filter(function (code) { return common.indexOf(code) < 0; });
+      return Promise.all(rare.map(postings)).then(function (lists) {
+        lists = lists.filter(function (list) { return list.length; });
+        var spare = Math.max(0, 3 * max - (rare.length - lists.length));
+        if (lists.length > spare || !common.length) return candidates(lists, spare);
+        return Promise.all(common.map(postings)).then(function (more) {
+          return candidates(lists.concat(more), spare);
+        });
+      }).then(function (found) {
+        return Promise.all(found.chunks.map(function (n) {
+          return chunk(n).then(function (symbols) {
+            var results = [];
+            symbols.forEach(function (symbol, i) {
+              if (!found.ids[n * meta.chunk + i]) return;
+              var match = F.distance(query, symbol.lower, max);
+              if (match.edits <= max) results.push({ symbol: symbol, score: F.rank(symbol, match.edits, match.end) });
+            });
+            return results;
+          });
+        })).then(function (lists) { return [].concat.apply([], lists); });
+      });
+    }).then(function (results) {
+      results.sort(function (a, b) { return a.score - b.score; });
+      return results.slice(0, limit);
+    });
+  }
+
+  document.addEventListener("DOMContentLoaded", function () {
+    var input = document.getElementById("symbol-query");
+    if (!input || !input.hasAttribute("data-federated")) return;
+    F.ui(input, function () {
+      return get("meta.json", true).then(function () { return search; });
+    });
+  });
+
+  return { search: search };
+})();
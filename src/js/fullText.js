@@ -0,0 +1,187 @@
+// Copyright 2020 Rohit Goswami <rog32@hi.is>
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Full text search over the index written by tools/mkFullText.sh. Only
+// the shards holding the query's terms are fetched, and only the doc
+// tables of the best hits. Hits are ranked with BM25, the document side of
+// which is worked out ahead of time.
+var DoxyYodaFullText = (function () {
+  var script = document.currentScript;
+  var base = script ? script.src.replace(/[^\/]*$/, "") : "fulltext/";
+  var STOP = {};
+  ("a an and are as at be but by can for from has have if in into is it its no not of on or " +
+   "that the their then there these this to was when which will with").split(" ").forEach(function (word) {
+    STOP[word] = true;
+  });
+  var files = {};
+  var shards = {};
+  var meta;
+
+  function get(name, json) {
+    if (!files[name]) {
+      files[name] = fetch(base + name).then(function (response) {
+        if (!response.ok) throw new Error(name + ": " + response.status);
+        return json ? response.json() : response.text();
+      });
+    }
+    return files[name];
+  }
+
+  // Must match words() in tools/fullText.awk
+  function tokens(text) {
+    var seen = {};
+    // Stop words go before stemming, as in tools/fullText.awk ("this" is
+    // one, "thi" is not)
+    return text.toLowerCase().split(/[^a-z0-9]+/).filter(function (word) {
+      return word.length >= 2 && !STOP[word];
+    }).map(function (word) {
+      if (word.length > 3 && /s$/.test(word) && !/ss$/.test(word)) word = word.slice(0, -1);
+      return word;
+    }).filter(function (word) {
+      if (seen[word]) return false;
+      seen[word] = true;
+      return true;
+    });
+  }
+
+  function shardOf(term) {
+    var h = 0;
+    for (var i = 0; i < term.length; i++) h = (h * 31 + term.charCodeAt(i)) % meta.shards;
+    return h;
+  }
+
+  // term -> rest of its line, postings are only decoded when asked for
+  function shard(n) {
+    if (!shards[n]) {
+      shards[n] = get(n + ".txt").then(function (text) {
+        var terms = {};
+        text.split("\n").forEach(function (line) {
+          var space = line.indexOf(" ");
+          if (space > 0) terms[line.slice(0, space)] = line.slice(space + 1);
+        });
+        return terms;
+      }, function () { return {}; });
+    }
+    return shards[n];
+  }
+
+  function postings(term) {
+    return shard(shardOf(term)).then(function (terms) {
+      var list = [];
+      if (!terms[term]) return list;
+      var doc = 0;
+      terms[term].split(" ").forEach(function (posting) {
+        var comma = posting.indexOf(",");
+        doc += parseInt(posting.slice(0, comma), 36);
+        list.push(doc, parseInt(posting.slice(comma + 1), 36) / 100);
+      });
+      return list;
+    });
+  }
+
+  function describe(hits) {
+    var chunks = {};
+    hits.forEach(function (hit) { chunks[Math.floor(hit.doc / meta.chunk)] = true; });
+    return Promise.all(Object.keys(chunks).map(function (n) {
+      return get("docs." + n + ".txt").then(function (text) {
+        chunks[n] = text.split("\n");
+      });
+    })).then(function () {
+      return hits.map(function (hit) {
+        var line = chunks[Math.floor(hit.doc / meta.chunk)][hit.doc % meta.chunk].split("\t");
+        return { url: line[0], title: line[1], score: hit.score };
+      });
+    });
+  }
+
+  // Resolves to the best `limit` hits as { url, title, score }
+  function search(query, limit) {
+    limit = limit || 50;
+    return get("meta.json", true).then(function (m) {
+      meta = m;
+      var terms = tokens(query);
+      return Promise.all(terms.map(postings));
+    }).then(function (lists) {
+      var scores = new Map();
+      lists.forEach(function (list) {
+        var df = list.length / 2;
+        if (!df) return;
+        var idf = Math.log(1 + (meta.docs - df + 0.5) / (df + 0.5));
+        for (var i = 0; i < list.length; i += 2) {
+          scores.set(list[i], (scores.get(list[i]) || 0) + idf * list[i + 1]);
+        }
+      });
+      var hits = [];
+      scores.forEach(function (score, doc) { hits.push({ doc: doc, score: score }); });
+      hits.sort(function (a, b) { return b.score - a.score; });
+      return describe(hits.slice(0, limit)).then(function (results) {
+        results.total = hits.length;
+        return results;
+      });
+    });
+  }
+
+  function ui(input) {
+    var status = document.getElementById("fulltext-status");
+    var results = document.getElementById("fulltext-results");
+    var timer, latest = 0;
+
+    function run() {
+      var query = input.value.trim();
+      var ticket = ++latest;
+      var start = performance.now();
+      history.replaceState(null, "", query ? "?q=" + encodeURIComponent(query) : location.pathname);
+      if (!query) {
+        results.textContent = "";
+        status.textContent = "";
+        return;
+      }
+      search(query).then(function (hits) {
+        if (ticket !== latest) return;
+        results.textContent = "";
+        hits.forEach(function (hit) {
+          var item = document.createElement("li");
+          var link = document.createElement("a");
+          link.className = "el";
+          link.href = hit.url;
+          link.textContent = hit.title;
+          item.appendChild(link);
+          results.appendChild(item);
+        });
+        status.textContent = hits.total + " results in " + Math.round(performance.now() - start) + " ms";
+      });
+    }
+
+    input.addEventListener("input", function () {
+      clearTimeout(timer);
+      timer = setTimeout(run, 80);
+    });
+    input.form.addEventListener("submit", function (event) {
+      event.preventDefault();
+      run();
+    });
+    var query = new URLSearchParams(location.search).get("q");
+    if (query) {
+      input.value = query;
+      run();
+    }
+  }
+
+  document.addEventListener("DOMContentLoaded", function () {
+    var input = document.getElementById("fulltext-query");
+    if (input) ui(input);
+  });
+
+  return { search: search, tokens: tokens };
+})();
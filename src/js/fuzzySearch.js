@@ -0,0 +1,257 @@
+// Copyright 2020 Rohit Goswami <rog32@hi.is>
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Typo tolerant search over the fully qualified symbol names listed by
+// tools/mkSymbols.sh. Names sharing enough trigrams with the query are
+// checked with an edit distance bounded by the query length, and whatever
+// is close enough is ranked by distance, then classes before namespaces
+// before members, public before protected before private.
+var DoxyYodaFuzzy = (function () {
+  var KIND = { c: 0, n: 1, e: 2, t: 3, f: 4, v: 5, d: 6, m: 7 };
+  var LABEL = { c: "class", n: "namespace", e: "enum", t: "typedef", f: "function", v: "variable", d: "define", m: "member" };
+
+  // Trigrams are numbered by their three (ASCII, lower cased) characters
+  var GRAMS = 1 << 21;
+  function gram(text, i) {
+    return (Math.min(text.charCodeAt(i), 127) << 14) |
+      (Math.min(text.charCodeAt(i + 1), 127) << 7) | Math.min(text.charCodeAt(i + 2), 127);
+  }
+
+  // Distinct trigrams of a query
+  function trigrams(text) {
+    var codes = [];
+    for (var i = 0; i + 2 < text.length; i++) {
+      var code = gram(text, i);
+      if (codes.indexOf(code) < 0) codes.push(code);
+    }
+    return codes;
+  }
+
+  // How many typos a query of this length may have
+  function tolerance(length) {
+    return length < 5 ? 0 : length < 9 ? 1 : 2;
+  }
+
+  // Fewest edits turning the query into some substring of text (capped at
+  // max + 1), and where in text that substring ends. Myers' bit parallel
+  // take on the edit distance table, a column per word, for queries up to
+  // 31 characters, longer ones are cut down to that.
+  var peq = new Int32Array(128), peqFor = null;
+  function distance(query, text, max) {
+    var m = Math.min(query.length, 31);
+    if (peqFor !== query) {
+      peq.fill(0);
+      for (var i = 0; i < m; i++) peq[Math.min(query.charCodeAt(i), 127)] |= 1 << i;
+      peqFor = query;
+    }
+    var top = 1 << (m - 1);
+    var pv = -1, mv = 0, score = m, best = m, end = 0;
+    for (var j = 0; j < text.length && best > 0; j++) {
+      var eq = peq[Math.min(text.charCodeAt(j), 127)];
+      var xv = eq | mv;
+      var xh = ((((eq & pv) + pv) | 0) ^ pv) | eq;
+      var ph = mv | ~(xh | pv);
+      var mh = pv & xh;
+      if (ph & top) score++;
+      else if (mh & top) score--;
+      // A match may start anywhere, so nothing comes in from row 0
+      ph <<= 1;
+      mh <<= 1;
+      pv = mh | ~(xv | ph);
+      mv = ph & xv;
+      if (score < best) {
+        best = score;
+        end = j + 1;
+      }
+    }
+    return { edits: Math.min(best, max + 1), end: end };
+  }
+
+  // Lower is better
+  function rank(symbol, edits, end) {
+    var last = symbol.lower.lastIndexOf("::") + 2;
+    return edits * 1000 + symbol.prot * 100 + KIND[symbol.kind] * 10 +
+      (end > last ? 0 : 5) + Math.min(symbol.name.length >> 3, 4);
+  }
+
+  function parse(text, prefix) {
+    var symbols = [];
+    text.split("\n").forEach(function (line) {
+      var field = line.split("\t");
+      if (field.length < 3) return;
+      symbols.push({
+        kind: field[0].charAt(0), prot: +field[0].charAt(1) || 0,
+        name: field[1], lower: field[1].toLowerCase(), url: (prefix || "") + field[2]
+      });
+    });
+    return symbols;
+  }
+
+  // Names checked with the edit distance per query at most, best trigram
+  // overlap first
+  var BUDGET = 3000;
+
+  // Postings of every trigram, packed into one array and found through
+  // start (the postings of trigram g are start[g] up to start[g + 1])
+  function Index(symbols) {
+    var start = new Int32Array(GRAMS + 1);
+    var last = new Int32Array(GRAMS).fill(-1);
+    var n, i, code;
+    for (n = 0; n < symbols.length; n++) {
+      for (i = 0; i + 2 < symbols[n].lower.length; i++) {
+        code = gram(symbols[n].lower, i);
+        if (last[code] !== n) {
+          last[code] = n;
+          start[code + 1]++;
+        }
+      }
+    }
+    for (code = 0; code < GRAMS; code++) start[code + 1] += start[code];
+    var fill = start.slice(0, GRAMS);
+    this.postings = new Int32Array(start[GRAMS]);
+    last.fill(-1);
+    for (n = 0; n < symbols.length; n++) {
+      for (i = 0; i + 2 < symbols[n].lower.length; i++) {
+        code = gram(symbols[n].lower, i);
+        if (last[code] !== n) {
+          last[code] = n;
+          this.postings[fill[code]++] = n;
+        }
+      }
+    }
+    this.start = start;
+    this.symbols = symbols;
+    this.hits = new Uint16Array(symbols.length);
+  }
+
+  // Names sharing enough of the query's trigrams, most shared first
+  Index.prototype.candidates = function (query) {
+    var start = this.start, all = trigrams(query);
+    function size(code) { return start[code + 1] - start[code]; }
+    var useful = all.filter(size).sort(function (a, b) { return size(a) - size(b); });
+    // Each typo spoils up to three trigrams, those no name has are spoilt
+    // for sure and leave fewer for the rest
+    var spare = Math.max(0, 3 * tolerance(query.length) - (all.length - useful.length));
+    // Trigrams most names have (the namespace, say) tell nothing apart,
+    // but enough are kept for one to be left whatever the typos spoil
+    var grams = useful.filter(function (code, i) {
+      return i <= spare || size(code) <= this.symbols.length >> 3;
+    }, this);
+    var need = Math.max(1, grams.length - spare);
+    var touched = [], buckets = [], found = [];
+    for (var g = 0; g < grams.length; g++) {
+      for (var i = this.start[grams[g]]; i < this.start[grams[g] + 1]; i++) {
+        if (this.hits[this.postings[i]]++ === 0) touched.push(this.postings[i]);
+      }
+    }
+    for (i = 0; i < touched.length; i++) {
+      var hits = this.hits[touched[i]];
+      this.hits[touched[i]] = 0;
+      if (hits >= need) (buckets[hits] || (buckets[hits] = [])).push(touched[i]);
+    }
+    for (g = buckets.length - 1; g >= need && found.length < BUDGET; g--) {
+      if (buckets[g]) found = found.concat(buckets[g]);
+    }
+    return found.slice(0, BUDGET);
+  };
+
+  Index.prototype.search = function (query, limit) {
+    limit = limit || 50;
+    query = query.trim().toLowerCase();
+    var symbols = this.symbols, results = [];
+    if (!query) return results;
+    if (query.length < 3) {
+      // Too short for trigrams, names starting with it will do
+      for (var n = 0; n < symbols.length && results.length < limit * 4; n++) {
+        var lower = symbols[n].lower;
+        var at = lower.lastIndexOf("::") + 2;
+        if (lower.lastIndexOf(query, 0) === 0 || lower.indexOf(query, at) === at) {
+          results.push({ symbol: symbols[n], score: rank(symbols[n], 0, lower.length) });
+        }
+      }
+    } else {
+      var max = tolerance(query.length);
+      this.candidates(query).forEach(function (n) {
+        var match = distance(query, symbols[n].lower, max);
+        if (match.edits <= max) results.push({ symbol: symbols[n], score: rank(symbols[n], match.edits, match.end) });
+      });
+    }
+    results.sort(function (a, b) { return a.score - b.score; });
+    return results.slice(0, limit);
+  };
+
+  function ui(input, load) {
+    var status = document.getElementById("symbol-status");
+    var list = document.getElementById("symbol-results");
+    var search = null, latest = 0;
+
+    function run() {
+      var query = input.value;
+      history.replaceState(null, "", query ? "?q=" + encodeURIComponent(query) : location.pathname);
+      if (!search) return;
+      var start = performance.now(), ticket = ++latest;
+      // Searches which have to fetch parts of their index come back later
+      Promise.resolve(search(query)).then(function (results) {
+        if (ticket === latest) show(query, results, start);
+      });
+    }
+
+    function show(query, results, start) {
+      list.textContent = "";
+      results.forEach(function (result) {
+        var item = document.createElement("li");
+        var link = document.createElement("a");
+        link.className = "el";
+        link.href = result.symbol.url;
+        link.textContent = result.symbol.name;
+        item.appendChild(link);
+        item.appendChild(document.createTextNode(" " + LABEL[result.symbol.kind] +
+          (result.symbol.project ? " in " + result.symbol.project : "")));
+        list.appendChild(item);
+      });
+      status.textContent = query ? results.length + " matches in " + (performance.now() - start).toFixed(1) + " ms" : "";
+    }
+
+    input.addEventListener("input", run);
+    input.form.addEventListener("submit", function (event) {
+      event.preventDefault();
+      run();
+    });
+    input.value = new URLSearchParams(location.search).get("q") || "";
+    status.textContent = "Loading symbols";
+    load().then(function (find) {
+      search = find;
+      status.textContent = "";
+      run();
+    });
+  }
+
+  document.addEventListener("DOMContentLoaded", function () {
+    var input = document.getElementById("symbol-query");
+    // The federated search (tools/mergeSymbols.sh) brings its own loader
+    if (!input || input.hasAttribute("data-federated")) return;
+    var base = input.getAttribute("data-symbols") || "symbols/symbols.txt";
+    ui(input, function () {
+      return fetch(base).then(function (response) { return response.text(); }).then(function (text) {
+        var index = new Index(parse(text));
+        return function (query) { return index.search(query); };
+      });
+    });
+  });
+
+  return {
+    Index: Index, parse: parse, trigrams: trigrams, tolerance: tolerance,
+    distance: distance, rank: rank, ui: ui
+  };
+})();
@@ -0,0 +1,81 @@
+// Copyright 2020 Rohit Goswami <rog32@hi.is>
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Streams in the rest of a sharded member index (see tools/shardIndex.sh)
+// whenever the sentinel left at the end of the page comes into view.
+(function () {
+  function stream(more) {
+    var base = more.getAttribute("data-base");
+    var chunks = parseInt(more.getAttribute("data-chunks"), 10);
+    var next = 1;
+    var busy = false;
+    // Wait before retrying a failed chunk, doubled on every failure
+    var delay = 1000;
+    var list = more.previousElementSibling;
+
+    function append(entries) {
+      entries.forEach(function (entry) {
+        if (entry.lastIndexOf("<h3>", 0) === 0) {
+          more.insertAdjacentHTML("beforebegin", entry + "<ul></ul>");
+          list = more.previousElementSibling;
+        } else {
+          list.insertAdjacentHTML("beforeend", entry);
+        }
+      });
+    }
+
+    function load(done) {
+      if (busy || next > chunks) return;
+      busy = true;
+      fetch(base + "." + next + ".json")
+        .then(function (response) {
+          if (!response.ok) throw new Error(response.status);
+          return response.json();
+        })
+        .then(function (entries) {
+          append(entries);
+          next++;
+          busy = false;
+          delay = 1000;
+          if (done) done();
+        })
+        .catch(function () {
+          // The observer only fires when the sentinel comes into view, not
+          // while it stays there, so retry on a timer
+          busy = false;
+          setTimeout(function () { load(done); }, delay);
+          delay = Math.min(2 * delay, 60000);
+        });
+    }
+
+    if (!("IntersectionObserver" in window)) {
+      (function all() { load(all); })();
+      return;
+    }
+    var observer = new IntersectionObserver(function (seen) {
+      if (!seen[0].isIntersecting) return;
+      load(function again() {
+        // Keep going while the sentinel is still close to the screen
+        if (next > chunks) observer.disconnect();
+        else if (more.getBoundingClientRect().top < 2 * window.innerHeight) load(again);
+      });
+    }, { rootMargin: "0px 0px 100% 0px" });
+    observer.observe(more);
+  }
+
+  document.addEventListener("DOMContentLoaded", function () {
+    var more = document.querySelector(".index-more");
+    if (more) stream(more);
+  });
+})();
@@ -0,0 +1,609 @@
+<?xml version="1.0" encoding="UTF-8"?>
+<!-- Copyright 2020 Rohit Goswami <rog32@hi.is>
+
+     Licensed under the Apache License, Version 2.0 (the "License");
+     you may not use this file except in compliance with the License.
+     You may obtain a copy of the License at
+
+     http://www.apache.org/licenses/LICENSE-2.0
+
+     Unless required by applicable law or agreed to in writing, software
+     distributed under the License is distributed on an "AS IS" BASIS,
+     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+     See the License for the specific language governing permissions and
+     limitations under the License. -->
+
+<!-- Renders the contents of the compounds in doxygen's XML output. Given
+     index.xml, every compound whose position modulo $shards is $shard is
+     written to $out<id>.body, so a few runs over the index share the work
+     without parsing the stylesheet once per page; shard 0 also writes the
+     index page and the tabs. Given a compound's own XML, that one is
+     written to the output. The sections come out in the order of the
+     matching page in the layout file. The header and footer are put around
+     it by tools/xmlSite.sh -->
+<xsl:stylesheet version="1.0"
+                xmlns:xsl="http://www.w3.org/1999/XSL/Transform"
+                xmlns:exsl="http://exslt.org/common"
+                xmlns:yoda="urn:doxyYoda"
+                extension-element-prefixes="exsl"
+                exclude-result-prefixes="yoda">
+  <xsl:output method="html" encoding="UTF-8" indent="no"/>
+
+  <xsl:param name="layout" select="'../xml/doxyYoda.xml'"/>
+  <xsl:param name="out" select="''"/>
+  <xsl:param name="shard" select="0"/>
+  <xsl:param name="shards" select="1"/>
+  <xsl:variable name="pages" select="document($layout)/doxygenlayout"/>
+  <xsl:variable name="names" select="document('')/*/yoda:names"/>
+
+  <!-- Layout entries against the XML they are built from -->
+  <yoda:names>
+    <yoda:decl layout="nestedclasses" inner="innerclass" title="Classes"/>
+    <yoda:decl layout="classes" inner="innerclass" title="Classes"/>
+    <yoda:decl layout="nestednamespaces" inner="innernamespace" title="Namespaces"/>
+    <yoda:decl layout="namespaces" inner="innernamespace" title="Namespaces"/>
+    <yoda:decl layout="nestedgroups" inner="innergroup" title="Modules"/>
+    <yoda:decl layout="dirs" inner="innerdir" title="Directories"/>
+    <yoda:decl layout="files" inner="innerfile" title="Files"/>
+    <yoda:decl layout="publictypes" kind="public-type" title="Public Types"/>
+    <yoda:decl layout="publicslots" kind="public-slot" title="Public Slots"/>
+    <yoda:decl layout="signals" kind="signal" title="Signals"/>
+    <yoda:decl layout="publicmethods" kind="public-func" title="Public Member Functions"/>
+    <yoda:decl layout="publicstaticmethods" kind="public-static-func" title="Static Public Member Functions"/>
+    <yoda:decl layout="publicattributes" kind="public-attrib" title="Public Attributes"/>
+    <yoda:decl layout="publicstaticattributes" kind="public-static-attrib" title="Static Public Attributes"/>
+    <yoda:decl layout="protectedtypes" kind="protected-type" title="Protected Types"/>
+    <yoda:decl layout="protectedslots" kind="protected-slot" title="Protected Slots"/>
+    <yoda:decl layout="protectedmethods" kind="protected-func" title="Protected Member Functions"/>
+    <yoda:decl layout="protectedstaticmethods" kind="protected-static-func" title="Static Protected Member Functions"/>
+    <yoda:decl layout="protectedattributes" kind="protected-attrib" title="Protected Attributes"/>
+    <yoda:decl layout="protectedstaticattributes" kind="protected-static-attrib" title="Static Protected Attributes"/>
+    <yoda:decl layout="packagetypes" kind="package-type" title="Package Types"/>
+    <yoda:decl layout="packagemethods" kind="package-func" title="Package Functions"/>
+    <yoda:decl layout="packagestaticmethods" kind="package-static-func" title="Static Package Functions"/>
+    <yoda:decl layout="packageattributes" kind="package-attrib" title="Package Attributes"/>
+    <yoda:decl layout="packagestaticattributes" kind="package-static-attrib" title="Static Package Attributes"/>
+    <yoda:decl layout="properties" kind="property" title="Properties"/>
+    <yoda:decl layout="events" kind="event" title="Events"/>
+    <yoda:decl layout="privatetypes" kind="private-type" title="Private Types"/>
+    <yoda:decl layout="privateslots" kind="private-slot" title="Private Slots"/>
+    <yoda:decl layout="privatemethods" kind="private-func" title="Private Member Functions"/>
+    <yoda:decl layout="privatestaticmethods" kind="private-static-func" title="Static Private Member Functions"/>
+    <yoda:decl layout="privateattributes" kind="private-attrib" title="Private Attributes"/>
+    <yoda:decl layout="privatestaticattributes" kind="private-static-attrib" title="Static Private Attributes"/>
+    <yoda:decl layout="friends" kind="friend" title="Friends"/>
+    <yoda:decl layout="related" kind="related" title="Related Functions"/>
+    <yoda:decl layout="defines" kind="define" title="Macros"/>
+    <yoda:decl layout="typedefs" kind="typedef" title="Typedefs"/>
+    <yoda:decl layout="enums" kind="enum" title="Enumerations"/>
+    <yoda:decl layout="functions" kind="func" title="Functions"/>
+    <yoda:decl layout="variables" kind="var" title="Variables"/>
+    <yoda:def layout="defines" kind="define" title="Macro Definition Documentation"/>
+    <yoda:def layout="typedefs" kind="typedef" title="Typedef Documentation"/>
+    <yoda:def layout="enums" kind="enum" title="Enumeration Type Documentation"/>
+    <yoda:def layout="functions" kind="function" title="Function Documentation"/>
+    <yoda:def layout="variables" kind="variable" title="Variable Documentation"/>
+    <yoda:def layout="properties" kind="property" title="Property Documentation"/>
+    <yoda:def layout="events" kind="event" title="Event Documentation"/>
+    <yoda:def layout="related" kind="friend" title="Friends And Related Function Documentation"/>
+    <yoda:page kind="class" layout="class" title="Class Reference"/>
+    <yoda:page kind="struct" layout="class" title="Struct Reference"/>
+    <yoda:page kind="union" layout="class" title="Union Reference"/>
+    <yoda:page kind="interface" layout="class" title="Interface Reference"/>
+    <yoda:page kind="exception" layout="class" title="Exception Reference"/>
+    <yoda:page kind="namespace" layout="namespace" title="Namespace Reference"/>
+    <yoda:page kind="file" layout="file" title="File Reference"/>
+    <yoda:page kind="group" layout="group" title=""/>
+    <yoda:page kind="dir" layout="directory" title="Directory Reference"/>
+    <!-- Tabs of the navindex, and the index page's sections they lead to -->
+    <yoda:tab type="mainpage" title="Main Page"/>
+    <yoda:tab type="pages" kinds=" page " title="Related Pages"/>
+    <yoda:tab type="modules" kinds=" group " title="Modules"/>
+    <yoda:tab type="namespaces" kinds=" namespace " title="Namespaces"/>
+    <yoda:tab type="classes" kinds=" class struct union interface exception " title="Classes"/>
+    <yoda:tab type="files" kinds=" file " title="Files"/>
+    <yoda:tab type="examples" kinds=" example " title="Examples"/>
+    <!-- Children of a para that cannot be inside a <p> -->
+    <yoda:block name="itemizedlist"/>
+    <yoda:block name="orderedlist"/>
+    <yoda:block name="simplesect"/>
+    <yoda:block name="parameterlist"/>
+    <yoda:block name="xrefsect"/>
+    <yoda:block name="table"/>
+    <yoda:block name="programlisting"/>
+    <yoda:block name="verbatim"/>
+    <yoda:block name="heading"/>
+    <yoda:block name="hruler"/>
+  </yoda:names>
+
+  <xsl:template match="/">
+    <xsl:apply-templates select="doxygen/compounddef | doxygenindex"/>
+  </xsl:template>
+
+  <xsl:template match="doxygenindex">
+    <xsl:for-each select="compound[(position() - 1) mod $shards = $shard]">
+      <exsl:document href="{$out}{@refid}.body" method="html" encoding="UTF-8" indent="no">
+        <xsl:apply-templates select="document(concat(@refid, '.xml'), .)/doxygen/compounddef"/>
+      </exsl:document>
+    </xsl:for-each>
+    <xsl:if test="$shard = 0">
+      <exsl:document href="{$out}annotated.body" method="html" encoding="UTF-8" indent="no">
+        <xsl:apply-templates select="." mode="index"/>
+      </exsl:document>
+      <exsl:document href="{$out}tabs.body" method="html" encoding="UTF-8" indent="no">
+        <xsl:apply-templates select="." mode="tabs"/>
+      </exsl:document>
+    </xsl:if>
+  </xsl:template>
+
+  <!-- The list of everything which has a page -->
+  <xsl:template match="doxygenindex" mode="index">
+    <xsl:variable name="index" select="."/>
+    <xsl:comment>title:Index</xsl:comment>
+    <xsl:text>&#10;</xsl:text>
+    <header class="header">
+      <h1 class="title">Index</h1>
+    </header>
+    <main class="contents">
+      <xsl:for-each select="$names/yoda:tab[@kinds]">
+        <xsl:call-template name="inner">
+          <xsl:with-param name="items" select="$index/compound[contains(current()/@kinds, concat(' ', @kind, ' '))]"/>
+          <xsl:with-param name="title" select="@title"/>
+          <xsl:with-param name="id" select="@type"/>
+        </xsl:call-template>
+      </xsl:for-each>
+    </main>
+  </xsl:template>
+
+  <!-- The visible top level tabs of the layout's navindex which have
+       anything to show, put under the header of every page by
+       tools/xmlPages.awk -->
+  <xsl:template match="doxygenindex" mode="tabs">
+    <xsl:variable name="index" select="."/>
+    <nav id="navrow1" class="tabs">
+      <ul class="tablist">
+        <xsl:for-each select="$pages/navindex/tab[not(@visible = 'no')]">
+          <xsl:variable name="tab" select="$names/yoda:tab[@type = current()/@type]"/>
+          <xsl:if test="$tab and (not($tab/@kinds) or $index/compound[contains($tab/@kinds, concat(' ', @kind, ' '))])">
+            <li>
+              <a>
+                <xsl:attribute name="href">
+                  <xsl:choose>
+                    <xsl:when test="$tab/@kinds">annotated.html#<xsl:value-of select="@type"/></xsl:when>
+                    <xsl:otherwise>index.html</xsl:otherwise>
+                  </xsl:choose>
+                </xsl:attribute>
+                <span>
+                  <xsl:choose>
+                    <xsl:when test="string(@title)"><xsl:value-of select="@title"/></xsl:when>
+                    <xsl:otherwise><xsl:value-of select="$tab/@title"/></xsl:otherwise>
+                  </xsl:choose>
+                </span>
+              </a>
+            </li>
+          </xsl:if>
+        </xsl:for-each>
+      </ul>
+    </nav>
+  </xsl:template>
+
+  <xsl:template match="compound" mode="link">
+    <a class="el" href="{@refid}.html"><xsl:value-of select="name"/></a>
+  </xsl:template>
+
+  <xsl:template match="compounddef">
+    <xsl:variable name="page" select="$names/yoda:page[@kind = current()/@kind]"/>
+    <xsl:variable name="title">
+      <xsl:choose>
+        <xsl:when test="title"><xsl:value-of select="title"/></xsl:when>
+        <xsl:otherwise><xsl:value-of select="concat(compoundname, ' ', $page/@title)"/></xsl:otherwise>
+      </xsl:choose>
+    </xsl:variable>
+    <!-- Picked up by tools/xmlSite.sh for $title -->
+    <xsl:comment>title:<xsl:value-of select="normalize-space($title)"/></xsl:comment>
+    <xsl:text>&#10;</xsl:text>
+    <header class="header">
+      <h1 class="title"><xsl:value-of select="$title"/></h1>
+    </header>
+    <main class="contents">
+      <xsl:choose>
+        <xsl:when test="$page">
+          <xsl:apply-templates select="$pages/*[name() = $page/@layout]/*" mode="layout">
+            <xsl:with-param name="compound" select="."/>
+          </xsl:apply-templates>
+        </xsl:when>
+        <!-- Pages and examples have no entry in the layout -->
+        <xsl:otherwise>
+          <xsl:apply-templates select="briefdescription | detaileddescription" mode="block"/>
+        </xsl:otherwise>
+      </xsl:choose>
+    </main>
+  </xsl:template>
+
+  <!-- @group Layout entries -->
+
+  <xsl:template match="*" mode="layout"/>
+
+  <xsl:template match="briefdescription" mode="layout">
+    <xsl:param name="compound"/>
+    <xsl:if test="not(@visible = 'no')">
+      <xsl:apply-templates select="$compound/briefdescription" mode="block"/>
+    </xsl:if>
+  </xsl:template>
+
+  <xsl:template match="detaileddescription" mode="layout">
+    <xsl:param name="compound"/>
+    <xsl:if test="$compound/detaileddescription/*">
+      <section class="textblock" id="details">
+        <h2 class="groupheader">Detailed Description</h2>
+        <xsl:apply-templates select="$compound/detaileddescription/*"/>
+      </section>
+    </xsl:if>
+  </xsl:template>
+
+  <xsl:template match="includes" mode="layout">
+    <xsl:param name="compound"/>
+    <xsl:if test="not(@visible = 'NO') and $compound/includes">
+      <ul class="includes">
+        <xsl:for-each select="$compound/includes">
+          <li>
+            <code>
+              <xsl:text>#include </xsl:text>
+              <xsl:choose>
+                <xsl:when test="@local = 'yes'">"<xsl:apply-templates select="." mode="link"/>"</xsl:when>
+                <xsl:otherwise>&lt;<xsl:apply-templates select="." mode="link"/>&gt;</xsl:otherwise>
+              </xsl:choose>
+            </code>
+          </li>
+        </xsl:for-each>
+      </ul>
+    </xsl:if>
+  </xsl:template>
+
+  <xsl:template match="memberdecl | memberdef" mode="layout">
+    <xsl:param name="compound"/>
+    <xsl:apply-templates select="*" mode="layout">
+      <xsl:with-param name="compound" select="$compound"/>
+      <xsl:with-param name="part" select="name()"/>
+    </xsl:apply-templates>
+  </xsl:template>
+
+  <xsl:template match="memberdecl/* | memberdef/*" mode="layout" priority="2">
+    <xsl:param name="compound"/>
+    <xsl:param name="part"/>
+    <xsl:variable name="key" select="name()"/>
+    <xsl:choose>
+      <xsl:when test="@visible = 'no'"/>
+      <xsl:when test="$part = 'memberdecl' and $names/yoda:decl[@layout = $key]/@inner">
+        <xsl:call-template name="inner">
+          <xsl:with-param name="items" select="$compound/*[name() = $names/yoda:decl[@layout = $key]/@inner]"/>
+          <xsl:with-param name="title" select="$names/yoda:decl[@layout = $key]/@title"/>
+        </xsl:call-template>
+      </xsl:when>
+      <xsl:when test="$part = 'memberdecl'">
+        <!-- Classes share "typedefs" and friends with namespaces and files -->
+        <xsl:for-each select="$names/yoda:decl[@layout = $key and @kind]">
+          <xsl:call-template name="declarations">
+            <xsl:with-param name="section" select="$compound/sectiondef[@kind = current()/@kind]"/>
+            <xsl:with-param name="title" select="@title"/>
+          </xsl:call-template>
+        </xsl:for-each>
+      </xsl:when>
+      <xsl:otherwise>
+        <xsl:for-each select="$names/yoda:def[@layout = $key]">
+          <xsl:call-template name="definitions">
+            <xsl:with-param name="members" select="$compound/sectiondef/memberdef[@kind = current()/@kind]"/>
+            <xsl:with-param name="title" select="@title"/>
+          </xsl:call-template>
+        </xsl:for-each>
+      </xsl:otherwise>
+    </xsl:choose>
+  </xsl:template>
+
+  <!-- @end -->
+
+  <!-- @group Member lists -->
+
+  <xsl:template name="inner">
+    <xsl:param name="items"/>
+    <xsl:param name="title"/>
+    <xsl:param name="id"/>
+    <xsl:if test="$items">
+      <section class="memberdecls">
+        <xsl:if test="$id"><xsl:attribute name="id"><xsl:value-of select="$id"/></xsl:attribute></xsl:if>
+        <h2 class="groupheader"><xsl:value-of select="$title"/></h2>
+        <ul>
+          <xsl:for-each select="$items">
+            <li class="memdecl">
+              <span class="memItemRight"><xsl:apply-templates select="." mode="link"/></span>
+            </li>
+          </xsl:for-each>
+        </ul>
+      </section>
+    </xsl:if>
+  </xsl:template>
+
+  <xsl:template name="declarations">
+    <xsl:param name="section"/>
+    <xsl:param name="title"/>
+    <xsl:if test="$section/memberdef">
+      <section class="memberdecls">
+        <h2 class="groupheader">
+          <xsl:choose>
+            <xsl:when test="$section/header"><xsl:value-of select="$section/header"/></xsl:when>
+            <xsl:otherwise><xsl:value-of select="$title"/></xsl:otherwise>
+          </xsl:choose>
+        </h2>
+        <ul>
+          <xsl:for-each select="$section/memberdef">
+            <li class="memdecl">
+              <code class="memItemLeft"><xsl:apply-templates select="type"/></code>
+              <code class="memItemRight">
+                <a class="el">
+                  <xsl:attribute name="href"><xsl:apply-templates select="." mode="href"/></xsl:attribute>
+                  <xsl:value-of select="name"/>
+                </a>
+                <xsl:value-of select="argsstring"/>
+                <xsl:if test="initializer and @kind != 'define'">
+                  <xsl:text> </xsl:text><xsl:apply-templates select="initializer"/>
+                </xsl:if>
+              </code>
+              <xsl:if test="briefdescription/*">
+                <div class="mdescRight"><xsl:apply-templates select="briefdescription/para/node()"/></div>
+              </xsl:if>
+            </li>
+          </xsl:for-each>
+        </ul>
+      </section>
+    </xsl:if>
+  </xsl:template>
+
+  <xsl:template name="definitions">
+    <xsl:param name="members"/>
+    <xsl:param name="title"/>
+    <xsl:if test="$members">
+      <section class="memberdefs">
+        <h2 class="groupheader"><xsl:value-of select="$title"/></h2>
+        <xsl:for-each select="$members">
+          <article class="memitem">
+            <xsl:attribute name="id"><xsl:apply-templates select="." mode="anchor"/></xsl:attribute>
+            <h3 class="memtitle"><xsl:value-of select="name"/></h3>
+            <div class="memproto">
+              <xsl:for-each select="templateparamlist">
+                <code class="memtemplate">
+                  <xsl:text>template&lt;</xsl:text>
+                  <xsl:for-each select="param">
+                    <xsl:if test="position() > 1">, </xsl:if>
+                    <xsl:apply-templates select="type"/>
+                    <xsl:if test="declname"><xsl:text> </xsl:text><xsl:value-of select="declname"/></xsl:if>
+                  </xsl:for-each>
+                  <xsl:text>&gt;</xsl:text>
+                </code>
+              </xsl:for-each>
+              <code class="memname">
+                <xsl:value-of select="definition"/>
+                <xsl:value-of select="argsstring"/>
+              </code>
+            </div>
+            <div class="memdoc">
+              <xsl:apply-templates select="briefdescription/* | detaileddescription/*"/>
+              <xsl:if test="enumvalue">
+                <dl class="enumvalues">
+                  <xsl:for-each select="enumvalue">
+                    <dt>
+                      <xsl:attribute name="id"><xsl:apply-templates select="." mode="anchor"/></xsl:attribute>
+                      <code><xsl:value-of select="name"/></code>
+                    </dt>
+                    <dd><xsl:apply-templates select="briefdescription/* | detaileddescription/*"/></dd>
+                  </xsl:for-each>
+                </dl>
+              </xsl:if>
+            </div>
+          </article>
+        </xsl:for-each>
+      </section>
+    </xsl:if>
+  </xsl:template>
+
+  <!-- @end -->
+
+  <!-- @group Links -->
+
+  <!-- Member ids are the id of the page they are documented on, "_1" and
+     the anchor ("a" and a hash, "ga" and one in groups, longer ones for
+     enum values). Page ids may have "_1" in them as well, anchors never -->
+  <xsl:template name="anchor">
+    <xsl:param name="id"/>
+    <xsl:choose>
+      <xsl:when test="contains($id, '_1')">
+        <xsl:call-template name="anchor">
+          <xsl:with-param name="id" select="substring-after($id, '_1')"/>
+        </xsl:call-template>
+      </xsl:when>
+      <xsl:otherwise><xsl:value-of select="$id"/></xsl:otherwise>
+    </xsl:choose>
+  </xsl:template>
+
+  <xsl:template name="href">
+    <xsl:param name="id"/>
+    <xsl:variable name="anchor">
+      <xsl:call-template name="anchor">
+        <xsl:with-param name="id" select="$id"/>
+      </xsl:call-template>
+    </xsl:variable>
+    <xsl:value-of select="concat(substring($id, 1, string-length($id) - string-length($anchor) - 2), '.html#', $anchor)"/>
+  </xsl:template>
+
+  <xsl:template match="memberdef | enumvalue" mode="anchor">
+    <xsl:call-template name="anchor">
+      <xsl:with-param name="id" select="@id"/>
+    </xsl:call-template>
+  </xsl:template>
+
+  <xsl:template match="memberdef | enumvalue" mode="href">
+    <xsl:call-template name="href">
+      <xsl:with-param name="id" select="@id"/>
+    </xsl:call-template>
+  </xsl:template>
+
+  <xsl:template match="*" mode="link">
+    <xsl:choose>
+      <xsl:when test="@refid">
+        <a class="el" href="{@refid}.html"><xsl:value-of select="."/></a>
+      </xsl:when>
+      <xsl:otherwise><xsl:value-of select="."/></xsl:otherwise>
+    </xsl:choose>
+  </xsl:template>
+
+  <xsl:template match="ref">
+    <a class="el">
+      <xsl:attribute name="href">
+        <xsl:choose>
+          <xsl:when test="@kindref = 'member'">
+            <xsl:call-template name="href">
+              <xsl:with-param name="id" select="@refid"/>
+            </xsl:call-template>
+          </xsl:when>
+          <xsl:otherwise><xsl:value-of select="concat(@refid, '.html')"/></xsl:otherwise>
+        </xsl:choose>
+      </xsl:attribute>
+      <xsl:apply-templates/>
+    </a>
+  </xsl:template>
+
+  <xsl:template match="ulink">
+    <a href="{@url}"><xsl:apply-templates/></a>
+  </xsl:template>
+
+  <!-- @end -->
+
+  <!-- @group Descriptions -->
+
+  <xsl:template match="briefdescription | detaileddescription" mode="block">
+    <xsl:if test="*">
+      <div class="textblock"><xsl:apply-templates select="*"/></div>
+    </xsl:if>
+  </xsl:template>
+
+  <!-- Lists, tables and code are inside a para in doxygen's XML, only the
+     runs of text between them become paragraphs -->
+  <xsl:template match="para">
+    <xsl:apply-templates select="node()[1]" mode="para"/>
+  </xsl:template>
+
+  <xsl:template match="node()" mode="para">
+    <xsl:choose>
+      <xsl:when test="name() = $names/yoda:block/@name">
+        <xsl:apply-templates select="."/>
+        <xsl:apply-templates select="following-sibling::node()[1]" mode="para"/>
+      </xsl:when>
+      <xsl:when test="self::text() and not(normalize-space())">
+        <xsl:apply-templates select="following-sibling::node()[1]" mode="para"/>
+      </xsl:when>
+      <xsl:otherwise>
+        <p><xsl:apply-templates select="." mode="run"/></p>
+        <xsl:apply-templates select="following-sibling::node()[name() = $names/yoda:block/@name][1]" mode="para"/>
+      </xsl:otherwise>
+    </xsl:choose>
+  </xsl:template>
+
+  <xsl:template match="node()" mode="run">
+    <xsl:apply-templates select="."/>
+    <xsl:apply-templates select="following-sibling::node()[1][not(name() = $names/yoda:block/@name)]" mode="run"/>
+  </xsl:template>
+
+  <xsl:template match="bold"><b><xsl:apply-templates/></b></xsl:template>
+  <xsl:template match="emphasis"><em><xsl:apply-templates/></em></xsl:template>
+  <xsl:template match="computeroutput"><code><xsl:apply-templates/></code></xsl:template>
+  <xsl:template match="linebreak"><br/></xsl:template>
+  <xsl:template match="hruler"><hr/></xsl:template>
+  <xsl:template match="itemizedlist"><ul><xsl:apply-templates/></ul></xsl:template>
+  <xsl:template match="orderedlist"><ol><xsl:apply-templates/></ol></xsl:template>
+  <xsl:template match="listitem"><li><xsl:apply-templates/></li></xsl:template>
+  <xsl:template match="verbatim"><pre class="fragment"><xsl:apply-templates/></pre></xsl:template>
+  <xsl:template match="formula"><xsl:value-of select="."/></xsl:template>
+  <xsl:template match="anchor"><span id="{@id}"/></xsl:template>
+
+  <xsl:template match="heading">
+    <xsl:element name="h{@level}"><xsl:apply-templates/></xsl:element>
+  </xsl:template>
+
+  <xsl:template match="sect1 | sect2 | sect3 | sect4">
+    <section id="{@id}">
+      <xsl:element name="h{substring(name(), 5) + 1}"><xsl:value-of select="title"/></xsl:element>
+      <xsl:apply-templates select="*[not(self::title)]"/>
+    </section>
+  </xsl:template>
+
+  <xsl:template match="simplesect">
+    <dl class="section {@kind}">
+      <dt>
+        <xsl:choose>
+          <xsl:when test="title"><xsl:value-of select="title"/></xsl:when>
+          <xsl:otherwise>
+            <xsl:value-of select="translate(substring(@kind, 1, 1), 'abcdefghijklmnopqrstuvwxyz', 'ABCDEFGHIJKLMNOPQRSTUVWXYZ')"/>
+            <xsl:value-of select="substring(@kind, 2)"/>
+          </xsl:otherwise>
+        </xsl:choose>
+      </dt>
+      <dd><xsl:apply-templates select="*[not(self::title)]"/></dd>
+    </dl>
+  </xsl:template>
+
+  <xsl:template match="xrefsect">
+    <dl class="{substring-before(@id, '_')}">
+      <dt><xsl:value-of select="xreftitle"/></dt>
+      <dd><xsl:apply-templates select="xrefdescription/*"/></dd>
+    </dl>
+  </xsl:template>
+
+  <xsl:template match="parameterlist">
+    <dl class="params">
+      <dt>
+        <xsl:choose>
+          <xsl:when test="@kind = 'templateparam'">Template Parameters</xsl:when>
+          <xsl:when test="@kind = 'retval'">Return values</xsl:when>
+          <xsl:when test="@kind = 'exception'">Exceptions</xsl:when>
+          <xsl:otherwise>Parameters</xsl:otherwise>
+        </xsl:choose>
+      </dt>
+      <xsl:for-each select="parameteritem">
+        <dd>
+          <code class="paramname">
+            <xsl:for-each select="parameternamelist/parametername">
+              <xsl:if test="position() > 1">, </xsl:if>
+              <xsl:apply-templates/>
+            </xsl:for-each>
+          </code>
+          <xsl:text> </xsl:text>
+          <xsl:apply-templates select="parameterdescription/para/node()"/>
+        </dd>
+      </xsl:for-each>
+    </dl>
+  </xsl:template>
+
+  <xsl:template match="table">
+    <table class="doxtable">
+      <xsl:for-each select="row">
+        <tr>
+          <xsl:for-each select="entry">
+            <xsl:element name="{substring('tdth', 1 + 2 * (@thead = 'yes'), 2)}">
+              <xsl:apply-templates select="para/node()"/>
+            </xsl:element>
+          </xsl:for-each>
+        </tr>
+      </xsl:for-each>
+    </table>
+  </xsl:template>
+
+  <!-- Source code, in the same markup doxygen uses so the fragments fold -->
+  <xsl:template match="programlisting">
+    <div class="fragment"><xsl:apply-templates select="codeline"/></div>
+  </xsl:template>
+  <xsl:template match="codeline"><div class="line"><xsl:apply-templates/></div></xsl:template>
+  <xsl:template match="highlight"><span class="{@class}"><xsl:apply-templates/></span></xsl:template>
+  <xsl:template match="highlight[@class = 'normal']"><xsl:apply-templates/></xsl:template>
+  <xsl:template match="sp"><xsl:text> </xsl:text></xsl:template>
+
+  <!-- @end -->
+</xsl:stylesheet>
@@ -0,0 +1,77 @@
+#!/usr/bin/env sh
+
+# Finds links to pages, files and anchors which don't exist anywhere in a
+# generated site. Every page is read once, in parallel, for its ids and
+# links; relative links (as written for $relpath^) are resolved against
+# the page. Exits non zero when anything dangles.
+# Usage: checkLinks.sh <html dir>
+if [ "$1" = "--pages" ]; then
+  out=$(mktemp "$2/links.XXXXXX")
+  shift 2
+  awk '
+    function resolve(page, href,    n, i, part, path, out, k) {
+      if (substr(href, 1, 1) == "#") return page href
+      if (substr(href, 1, 1) != "/") {
+        path = page
+        sub(/[^\/]*$/, "", path)
+        href = path href
+      }
+      n = split(href, part, "/")
+      k = 0
+      for (i = 1; i <= n; i++) {
+        if (part[i] == "." || part[i] == "") continue
+        if (part[i] == "..") { if (k > 0) k--; continue }
+        out[++k] = part[i]
+      }
+      path = ""
+      for (i = 1; i <= k; i++) path = path (i > 1 ? "/" : "") out[i]
+      return path
+    }
+    FNR == 1 {
+      page = substr(FILENAME, length(root) + 2)
+      print page "\tD"
+    }
+    {
+      line = $0
+      while (match(line, /(id|name|href)="[^"]*"/)) {
+        attr = substr(line, RSTART, RLENGTH)
+        line = substr(line, RSTART + RLENGTH)
+        value = attr
+        sub(/^[a-z]*="/, "", value)
+        sub(/"$/, "", value)
+        if (attr ~ /^href/) {
+          # Other sites, scripts and the logo placeholder are not checked
+          if (value ~ /^[a-zA-Z][a-zA-Z0-9+.-]*:/ || value == "#" || value == "") continue
+          sub(/\?[^#]*/, "", value)
+          gsub(/&amp;/, "\\&", value)
+          print resolve(page, value) "\tR\t" page
+        } else {
+          print page "#" value "\tD"
+        }
+      }
+    }
+  ' root="$root" "$@" > "$out"
+  exit
+fi
+
+html=${1:?"Usage: $0 <html dir>"}
+jobs=$(nproc 2>/dev/null || echo 4)
+export root="${html%/}"
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+# Every file is a target too, not just the pages
+(cd "$root" && find . -type f ! -name '*.html' | sed 's|^\./||; s|$|\tD|') > "$work/files"
+find "$root" -name '*.html' | xargs -n 256 -P "$jobs" sh "$0" --pages "$work"
+
+cat "$work"/links.* "$work/files" | LC_ALL=C sort -t "$(printf '\t')" -k1,1 -k2,2 | awk -F '\t' '
+  $2 == "D" { defined = $1; next }
+  $1 != defined {
+    print $3 ": " $1
+    dangling++
+  }
+  END {
+    print (dangling + 0) " dangling links" > "/dev/stderr"
+    exit (dangling > 0)
+  }
+'
@@ -0,0 +1,40 @@
+# Helpers shared by the tools, source it and call
+#   doxyval <Doxyfile> <KEY>  to read a setting out of a Doxyfile
+#   sitePage <html dir> <page> <body file>  to write an extra page into a
+#                                           generated site
+
+doxyval() {
+  awk -v key="$2" '
+    $0 ~ "^[ \t]*" key "[ \t]*\\+?=" {
+      if ($0 !~ /\+=/) value = ""
+      sub(/^[^=]*=[ \t]*/, "")
+      grab = 1
+    }
+    grab {
+      more = sub(/[ \t]*\\[ \t]*$/, "")
+      value = value (value == "" ? "" : " ") $0
+      grab = more
+    }
+    END {
+      gsub(/"/, "", value)
+      sub(/[ \t]+$/, "", value)
+      print value
+    }
+  ' "$1"
+}
+
+# The body goes between the header and footer of the site's index.html,
+# after the #top div the header opens is closed as doxygen does it
+sitePage() {
+  awk -v body="$3" '
+    { page = page $0 "\n" }
+    END {
+      head = index(page, "<!-- end header part -->")
+      foot = index(page, "<!-- start footer part -->")
+      if (!head || !foot) exit 1
+      while ((getline line < body) > 0) text = text line "\n"
+      printf "%s\n</div><!-- top -->\n%s%s", substr(page, 1, head + 23), text, substr(page, foot)
+    }
+  ' "$1/index.html" > "$1/$2" ||
+    { rm -f "$1/$2"; echo "No header and footer markers in $1/index.html, $2 not written" >&2; }
+}
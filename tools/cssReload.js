@@ -0,0 +1,42 @@
+// Copyright 2020 Rohit Goswami <rog32@hi.is>
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Only injected by tools/devServer.sh. Watches the page's stylesheets and
+// swaps in a fresh copy when one changes, keeping the scroll position.
+(function () {
+  var seen = {};
+
+  function check(link) {
+    var href = link.href.split("?")[0];
+    fetch(href, { method: "HEAD", cache: "no-store" }).then(function (response) {
+      var stamp = response.headers.get("Last-Modified") + response.headers.get("Content-Length");
+      if (seen[href] && seen[href] !== stamp) {
+        var fresh = link.cloneNode();
+        fresh.href = href + "?" + Date.now();
+        // Drop the old sheet only once the new one applies, so nothing flashes
+        fresh.onload = function () { link.remove(); };
+        link.after(fresh);
+      }
+      seen[href] = stamp;
+    }).catch(function () {
+      // devServer.sh is stopped or restarting, the next tick tries again
+    });
+  }
+
+  setInterval(function () {
+    document.querySelectorAll('link[rel="stylesheet"]').forEach(function (link) {
+      if (link.href.indexOf(location.origin) === 0) check(link);
+    });
+  }, 250);
+})();
@@ -0,0 +1,55 @@
+#!/usr/bin/env sh
+
+# One command for working on the theme against a project. Sass recompiles
+# in watch mode, the compiled stylesheet is swapped into open pages without
+# a reload, header and footer edits are put on the existing pages and
+# layout edits rebuild the docs.
+# Needs dart sass, inotifywait (inotify-tools) and darkhttpd or python3.
+# Usage: devServer.sh <Doxyfile> [port]
+doxyfile=${1:?"Usage: $0 <Doxyfile> [port]"}
+port=${2:-8080}
+here=$(cd "$(dirname "$0")" && pwd)
+. "$here/config.sh"
+theme=$(cd "$here/.." && pwd)
+cd "$(dirname "$doxyfile")" || exit 1
+doxyfile=$(basename "$doxyfile")
+html=$(doxyval "$doxyfile" HTML_OUTPUT)
+html=${html:-html}
+case $html in
+  /*) ;;
+  *) outdir=$(doxyval "$doxyfile" OUTPUT_DIRECTORY); html=${outdir:-.}/$html ;;
+esac
+css=$theme/src/styles/doxyYoda.css
+
+# Pulls the stylesheet in again whenever it changes on disk
+inject() {
+  cp "$here/cssReload.js" "$html"
+  grep -L 'cssReload.js' "$html"/*.html |
+    xargs -r sed -i 's|</head>|<script type="text/javascript" src="cssReload.js"></script>\n</head>|'
+}
+
+rebuild() {
+  echo "Rebuilding docs"
+  doxygen "$doxyfile" > /dev/null && inject
+}
+
+trap 'kill 0' INT TERM EXIT
+sass --watch "$theme/src/styles/scss/main.scss:$css" &
+[ -d "$html" ] || rebuild
+inject
+if command -v darkhttpd > /dev/null; then
+  darkhttpd "$html" --port "$port" --no-listing > /dev/null &
+else
+  python3 -m http.server "$port" --directory "$html" > /dev/null 2>&1 &
+fi
+echo "Serving $html on http://localhost:$port"
+
+inotifywait -mq -e close_write,moved_to --format '%w%f' \
+  "$theme/src/styles" "$theme/src/html" "$theme/src/xml" |
+  while IFS= read -r file; do
+    case $file in
+      *.css) cp "$file" "$html" ;;
+      *.html) "$here/reTemplate.sh" "$doxyfile" "$html" > /dev/null && inject ;;
+      *.xml) rebuild ;;
+    esac
+  done
@@ -0,0 +1,44 @@
+#!/usr/bin/env sh
+
+# Renames the theme's stylesheets and fonts in a generated site to
+# name.<hash>.ext and points every page at the new names, so servers can
+# cache them for good (the immutable rule in tools/nginx.conf). Fonts go
+# first, as the stylesheets name them. Doxygen writes the stylesheet under
+# the name given in HTML_EXTRA_STYLESHEET, which is why this is done on
+# the site and not in the release. Run it after the other tools and
+# before precompress.sh or mkArchive.sh; names already hashed are left.
+# Usage: fingerprint.sh <html dir>
+html=${1:?"Usage: $0 <html dir>"}
+jobs=$(nproc 2>/dev/null || echo 4)
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+: > "$tmp/rename.sed"
+
+# Renames the files given, adding to the sed script which rewrites
+# references to them
+rename() {
+  for file; do
+    [ -f "$file" ] || continue
+    name=$(basename "$file")
+    case $name in
+      *.[0-9a-f][0-9a-f][0-9a-f][0-9a-f][0-9a-f][0-9a-f][0-9a-f][0-9a-f][0-9a-f][0-9a-f].*) continue ;;
+    esac
+    hash=$(sha256sum < "$file" | cut -c1-10)
+    new=${name%.*}.$hash.${name##*.}
+    mv "$file" "$(dirname "$file")/$new"
+    # Only whole names, after a quote, parenthesis or slash
+    printf 's#\\(["'"'"'(/]\\)%s\\(["'"'"')?\\#]\\)#\\1%s\\2#g\n' "$(printf '%s' "$name" | sed 's/[.[\*^$]/\\&/g')" "$new" \
+      >> "$tmp/rename.sed"
+    echo "$name -> $new"
+  done
+}
+
+rename "$html"/*.woff2 "$html"/*.woff
+if [ -s "$tmp/rename.sed" ]; then
+  for css in "$html"/doxyYoda*.css; do
+    [ -f "$css" ] && sed -i -f "$tmp/rename.sed" "$css"
+  done
+fi
+rename "$html"/doxyYoda*.css
+[ -s "$tmp/rename.sed" ] || { echo "Nothing to fingerprint in $html"; exit; }
+find "$html" -name '*.html' -print0 | xargs -0 -n 256 -P "$jobs" sed -i -f "$tmp/rename.sed"
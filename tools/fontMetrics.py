@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+# Copyright 2020 Rohit Goswami <rog32@hi.is>
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Writes the metric overrides for the fallback faces in _fontMetrics.scss.
+
+Each web font is measured (average glyph width, ascent, descent and line
+gap) and compared with the local font the browser shows until it loads.
+The fallback face is scaled so both set text to the same width and line
+height, and the swap no longer moves anything.
+
+Usage: fontMetrics.py [--fallback <kind>=<font file>]... <kind>=<font file>...
+  <kind> is serif, sans-serif or monospace, font files are anything
+  fontTools reads (ttf, otf, woff, woff2). Without --fallback the metrics of
+  Times New Roman, Arial and Courier New are used.
+Example:
+  fontMetrics.py serif=Vollkorn-Regular.ttf sans-serif=PTSans-Regular.ttf \\
+    monospace=CascadiaCode.woff2 > src/styles/scss/_fontMetrics.scss
+"""
+
+import sys
+
+from fontTools.ttLib import TTFont
+
+# Local faces tried for each kind, all metric compatible with the first
+LOCAL = {
+    "serif": ["Times New Roman", "Times", "Liberation Serif", "Tinos"],
+    "sans-serif": ["Arial", "Helvetica", "Liberation Sans", "Arimo"],
+    "monospace": ["Courier New", "Courier", "Liberation Mono", "Cousine"],
+}
+
+# (unitsPerEm, xAvgCharWidth) of the first face in LOCAL
+FALLBACK = {
+    "serif": (2048, 821),
+    "sans-serif": (2048, 904),
+    "monospace": (2048, 1229),
+}
+
+
+def measure(path):
+    font = TTFont(path, lazy=True)
+    upm = font["head"].unitsPerEm
+    os2 = font["OS/2"]
+    hhea = font["hhea"]
+    # Browsers go by the typo metrics only when the font asks for it
+    if os2.fsSelection & (1 << 7):
+        ascent, descent, gap = os2.sTypoAscender, os2.sTypoDescender, os2.sTypoLineGap
+    else:
+        ascent, descent, gap = hhea.ascent, hhea.descent, hhea.lineGap
+    names = font["name"]
+    family = names.getDebugName(16) or names.getDebugName(1)
+    return family, names.getDebugName(5), upm, os2.xAvgCharWidth, ascent, descent, gap
+
+
+def percent(value):
+    return "%.2f%%" % (100 * value)
+
+
+def main(args):
+    fallback = dict(FALLBACK)
+    fonts = []
+    while args:
+        arg = args.pop(0)
+        if arg == "--fallback":
+            kind, path = args.pop(0).split("=", 1)
+            _, _, upm, width, *_ = measure(path)
+            fallback[kind] = (upm, width)
+        elif "=" in arg and arg.split("=", 1)[0] in LOCAL:
+            fonts.append(arg.split("=", 1))
+        else:
+            sys.exit(__doc__)
+    if not fonts:
+        sys.exit(__doc__)
+
+    measured = [(kind, measure(path)) for kind, path in fonts]
+    print("// Written by tools/fontMetrics.py, do not edit. Measured from")
+    for kind, (family, version, *_) in measured:
+        print("// %s %s" % (family, version))
+    print("$font-metrics: (")
+    for kind, (family, _, upm, width, ascent, descent, gap) in measured:
+        local_upm, local_width = fallback[kind]
+        size = (width / upm) / (local_width / local_upm)
+        print('  "%s": (' % family)
+        print("    local: (%s)," % ", ".join('"%s"' % name for name in LOCAL[kind]))
+        print("    size-adjust: %s," % percent(size))
+        print("    ascent-override: %s," % percent(ascent / upm / size))
+        print("    descent-override: %s," % percent(abs(descent) / upm / size))
+        print("    line-gap-override: %s," % percent(gap / upm / size))
+        print("  ),")
+    print(");")
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
@@ -0,0 +1,43 @@
+#!/usr/bin/env sh
+
+# Fetches the fonts for $self-hosted-fonts and cuts them down to Latin as
+# woff2, with the file names _myvars.scss expects. Vollkorn and Cascadia
+# Code keep their wght axis, PT Sans has no variable build and comes as
+# the three static styles the theme uses. The fallback metrics of the
+# regular faces are written to <out dir>/_fontMetrics.scss, to be copied
+# over src/styles/scss/_fontMetrics.scss whenever the fonts change. Needs
+# curl, unzip and fontTools (with brotli).
+# Usage: fonts.sh <out dir>
+out=${1:?"Usage: $0 <out dir>"}
+mkdir -p "$out"
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+ofl=https://github.com/google/fonts/raw/main/ofl
+cascadia=https://github.com/microsoft/cascadia-code/releases/download/v2111.01/CascadiaCode-2111.01.zip
+# Google Fonts' latin subset
+latin=U+0000-00FF,U+0131,U+0152-0153,U+02BB-02BC,U+02C6,U+02DA,U+02DC,U+0304,U+0308,U+0329,U+2000-206F,U+2074,U+20AC,U+2122,U+2191,U+2193,U+2212,U+2215,U+FEFF,U+FFFD
+
+fetch() {
+  curl -fsSL -o "$tmp/$1" "$2" || { echo "Could not fetch $2" >&2; exit 1; }
+}
+
+fetch Vollkorn.ttf "$ofl/vollkorn/Vollkorn%5Bwght%5D.ttf"
+fetch Vollkorn-Italic.ttf "$ofl/vollkorn/Vollkorn-Italic%5Bwght%5D.ttf"
+fetch PTSans-Regular.ttf "$ofl/ptsans/PT_Sans-Web-Regular.ttf"
+fetch PTSans-Bold.ttf "$ofl/ptsans/PT_Sans-Web-Bold.ttf"
+fetch PTSans-Italic.ttf "$ofl/ptsans/PT_Sans-Web-Italic.ttf"
+fetch cascadia.zip "$cascadia"
+unzip -q -j -o "$tmp/cascadia.zip" ttf/CascadiaCode.ttf -d "$tmp"
+
+for font in "$tmp"/*.ttf; do
+  name=$(basename "$font" .ttf)
+  # Every layout feature stays, body text asks for tnum, case, zero and ss01
+  pyftsubset "$font" --unicodes="$latin" --layout-features='*' \
+    --flavor=woff2 --output-file="$out/$name.woff2"
+  echo "$name.woff2: $(wc -c < "$font") -> $(wc -c < "$out/$name.woff2") bytes"
+done
+python3 "$(dirname "$0")/fontMetrics.py" serif="$out/Vollkorn.woff2" sans-serif="$out/PTSans-Regular.woff2" \
+  monospace="$out/CascadiaCode.woff2" > "$out/_fontMetrics.scss" || exit 1
+echo "Add $out/*.woff2 to HTML_EXTRA_FILES and set \$self-hosted-fonts: true"
+echo "Commit $out/_fontMetrics.scss as src/styles/scss/_fontMetrics.scss if it changed"
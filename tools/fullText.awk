@@ -0,0 +1,88 @@
+# Pulls the prose out of doxygen's XML for tools/mkFullText.sh. Every
+# documented compound, member and page becomes one line of
+#   url TAB title TAB words
+# with the words already normalised the way src/js/fullText.js normalises
+# queries. Code examples are left out.
+
+BEGIN {
+  FS = "\n"
+  n = split("a an and are as at be but by can for from has have if in into is it its no not of on or that the their then there these this to was when which will with", t, " ")
+  for (i = 1; i <= n; i++) stop[t[i]] = 1
+}
+
+function inner(s, tag, i, j) {
+  i = index(s, "<" tag ">")
+  if (!i) return ""
+  s = substr(s, i + length(tag) + 2)
+  j = index(s, "</" tag ">")
+  return j ? substr(s, 1, j - 1) : ""
+}
+
+# Must match tokens() in fullText.js
+function words(s, out, n, w, i, t) {
+  while ((i = index(s, "<programlisting")) > 0) {
+    t = substr(s, i)
+    n = index(t, "</programlisting>")
+    s = substr(s, 1, i - 1) " " (n ? substr(t, n + 17) : "")
+  }
+  gsub(/<[^>]*>/, " ", s)
+  gsub(/&[a-z]+;|&#[0-9]+;/, " ", s)
+  s = tolower(s)
+  gsub(/[^a-z0-9]+/, " ", s)
+  n = split(s, w, " ")
+  out = ""
+  for (i = 1; i <= n; i++) {
+    t = w[i]
+    if (length(t) < 2 || (t in stop)) continue
+    if (length(t) > 3 && t ~ /s$/ && t !~ /ss$/) t = substr(t, 1, length(t) - 1)
+    out = out (out == "" ? "" : " ") t
+  }
+  return out
+}
+
+function emit(url, title, prose, w) {
+  w = words(prose)
+  if (w == "") return
+  w = words(title) " " w
+  gsub(/[\t\n]/, " ", title)
+  gsub(/&lt;/, "<", title)
+  gsub(/&gt;/, ">", title)
+  gsub(/&quot;/, "\"", title)
+  gsub(/&apos;/, "'", title)
+  gsub(/&amp;/, "\\&", title)
+  print url "\t" title "\t" w
+}
+
+function compound(doc, id, name, title, m, i, j, mid, mname, page) {
+  if (!match(doc, /<compounddef id="[^"]*"/)) return
+  id = substr(doc, RSTART + 17, RLENGTH - 18)
+  name = inner(doc, "compoundname")
+  # Members are written up on the page their id starts with
+  while ((i = index(doc, "<memberdef ")) > 0) {
+    m = substr(doc, i)
+    j = index(m, "</memberdef>")
+    if (!j) break
+    m = substr(m, 1, j - 1)
+    doc = substr(doc, 1, i - 1) substr(doc, i + j + 11)
+    if (!match(m, / id="[^"]*"/)) continue
+    mid = substr(m, RSTART + 5, RLENGTH - 6)
+    if (!match(mid, /_1[^_]*$/)) continue
+    page = substr(mid, 1, RSTART - 1)
+    mname = inner(m, "name")
+    emit(page ".html#" substr(mid, RSTART + 2), name "::" mname,
+      inner(m, "briefdescription") " " inner(m, "detaileddescription"))
+  }
+  title = inner(doc, "title")
+  if (title == "") title = name
+  emit(id ".html", title,
+    inner(doc, "briefdescription") " " inner(doc, "detaileddescription"))
+}
+
+FNR == 1 && NR > 1 {
+  compound(doc)
+  doc = ""
+}
+
+{ doc = doc $0 "\n" }
+
+END { if (doc != "") compound(doc) }
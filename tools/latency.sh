@@ -0,0 +1,26 @@
+#!/usr/bin/env sh
+
+# Prints a histogram of request times from an access log written with the
+# doxyYoda log format in tools/nginx.conf (request time last).
+# Usage: latency.sh <access log>
+log=${1:?"Usage: $0 <access log>"}
+awk '
+  {
+    ms = $NF * 1000
+    bucket = 1
+    while (bucket < ms) bucket *= 2
+    count[bucket]++
+    if (bucket > top) top = bucket
+    n++
+    total += ms
+  }
+  END {
+    if (!n) exit
+    for (bucket = 1; bucket <= top; bucket *= 2) {
+      bar = ""
+      for (i = 0; i < 50 * count[bucket] / n; i++) bar = bar "#"
+      printf "<= %6d ms %8d %s\n", bucket, count[bucket], bar
+    }
+    printf "%d requests, %.2f ms mean\n", n, total / n
+  }
+' "$log"
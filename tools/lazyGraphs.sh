@@ -0,0 +1,77 @@
+#!/usr/bin/env sh
+
+# Makes the dot graphs load lazily and reserve their space up front.
+# Graphs taller than the second argument (in px) are folded away behind a
+# click to expand, like the code fragments.
+graphs='(__inherit__graph|__coll__graph|__incl|__dep__incl|_dep)\.(png|svg)"'
+
+if [ "$1" = "--pages" ]; then
+  max=$2
+  shift 2
+  for page; do
+    awk -v dir="$(dirname "$page")" -v max="$max" -v graphs="$graphs" '
+      function png(file, cmd, b, i, n) {
+        cmd = "od -An -tu1 -j16 -N8 \"" file "\""
+        n = 0
+        while ((cmd | getline line) > 0) {
+          split(line, b)
+          for (i = 1; i in b; i++) byte[++n] = b[i]
+        }
+        close(cmd)
+        if (n < 8) return 0
+        W = ((byte[1] * 256 + byte[2]) * 256 + byte[3]) * 256 + byte[4]
+        H = ((byte[5] * 256 + byte[6]) * 256 + byte[7]) * 256 + byte[8]
+        return 1
+      }
+      function length_of(tag, attr, v) {
+        if (!match(tag, attr "=\"[0-9.]+(pt|px)?\"")) return 0
+        v = substr(tag, RSTART + length(attr) + 2, RLENGTH - length(attr) - 3)
+        if (v ~ /pt$/) return int(v * 4 / 3 + 0.5)
+        return int(v + 0)
+      }
+      function svg(file, line, head) {
+        head = ""
+        while ((getline line < file) > 0) {
+          head = head " " line
+          if (head ~ /<svg[^>]*>/) break
+        }
+        close(file)
+        if (!match(head, /<svg[^>]*>/)) return 0
+        head = substr(head, RSTART, RLENGTH)
+        W = length_of(head, "width")
+        H = length_of(head, "height")
+        return W && H
+      }
+      $0 ~ graphs && /<img / && !/loading=/ {
+        match($0, /<img src="[^"]*"/)
+        src = substr($0, RSTART + 10, RLENGTH - 11)
+        file = dir "/" src
+        sized = src ~ /\.png$/ ? png(file) : svg(file)
+        attrs = "loading=\"lazy\" decoding=\"async\""
+        if (sized) attrs = attrs " width=\"" W "\" height=\"" H "\""
+        sub(/<img /, "<img " attrs " ")
+        if (sized && H > max && /<div class="center">.*<\/div>/) {
+          sub(/<div class="center">/, "<details class=\"graph-details\"><summary>Graph (" W " \\&#215; " H ")</summary>&")
+          $0 = $0 "</details>"
+        }
+      }
+      $0 ~ graphs && /<iframe / && !/loading=/ {
+        sub(/<iframe /, "<iframe loading=\"lazy\" ")
+        H = length_of($0, "height")
+        W = length_of($0, "width")
+        if (H > max && /<div class="center">.*<\/iframe><\/div>/) {
+          sub(/<div class="center">/, "<details class=\"graph-details\"><summary>Graph (" W " \\&#215; " H ")</summary>&")
+          $0 = $0 "</details>"
+        }
+      }
+      { print }
+    ' "$page" > "$page.tmp" && mv "$page.tmp" "$page"
+  done
+  exit
+fi
+
+html=${1:?"Usage: $0 <html dir> [max graph height]"}
+max=${2:-800}
+jobs=$(nproc 2>/dev/null || echo 4)
+grep -lrE --include='*.html' "$graphs" "$html" | xargs -n 64 -P "$jobs" sh "$0" --pages "$max"
+echo "Processed $(grep -lr --include='*.html' 'loading="lazy"' "$html" | wc -l) pages with graphs"
@@ -0,0 +1,165 @@
+# Merges doxygen's javascript search data (SEARCHENGINE = YES) of the
+# shards of tools/shardBuild.sh into one. Arguments are pairs of a search
+# directory and the directory its pages are in, relative to the merged
+# site, empty for the merged site's own:
+#   awk -v searchdata=... -v template=... -f mergeSearch.awk \
+#     html/search "" html/shard1/search shard1 ...
+# Entries with the same name are merged, targets found twice (a symbol
+# of one shard showing up as an external in another) are kept once.
+# Writes the new searchdata.js, a copy of one of the per letter html pages
+# to template, and prints one line per entry of every letter file,
+#   file TAB sort key TAB id TAB rest of the entry
+# for tools/shardBuild.sh to sort and write out.
+
+BEGIN {
+  for (i = 128; i < 192; i++) tail[sprintf("%c", i)] = 1
+  order = "all classes namespaces files functions variables typedefs enums enumvalues related defines groups pages"
+  nnames = split(order, names, " ")
+  for (i = 1; i <= nnames; i++) known[names[i]] = 1
+  for (a = 1; a + 1 < ARGC; a += 2) source(ARGV[a], ARGV[a + 1])
+  ARGC = 1
+  finish()
+}
+
+# The value of a "  0: \"...\"," line
+function quoted(s) {
+  sub(/^[^"]*"/, "", s)
+  sub(/",?[ \t]*$/, "", s)
+  gsub(/\\"/, "\"", s)
+  gsub(/\\\\/, "\\", s)
+  return s
+}
+
+# Splits a string of UTF-8 characters into list, returns their number
+function chars(s, list, n, i, c) {
+  n = 0
+  for (i = 1; i <= length(s); i++) {
+    c = substr(s, i, 1)
+    if (n && c in tail) list[n] = list[n] c
+    else list[++n] = c
+  }
+  return n
+}
+
+# A target's url as seen from the merged search directory
+function move(url, prefix) {
+  if (url ~ /^\.\.\/\.\.\//) return substr(url, 4)
+  if (url ~ /^\.\.\// && prefix != "") return "../" prefix "/" substr(url, 4)
+  return url
+}
+
+function source(dir, prefix, line, mode, key, value, nm, j, n, list, file, rest, id, name, i, c, targets, t, k, url) {
+  split("", label)
+  split("", content)
+  split("", section)
+  file = dir "/searchdata.js"
+  while ((getline line < file) > 0) {
+    if (line ~ /^var indexSectionsWithContent/) mode = "content"
+    else if (line ~ /^var indexSectionNames/) mode = "names"
+    else if (line ~ /^var indexSectionLabels/) mode = "labels"
+    else if (line ~ /^[ \t]*[0-9]+:/) {
+      key = line
+      sub(/^[ \t]*/, "", key)
+      sub(/:.*/, "", key)
+      value = quoted(line)
+      if (mode == "content") content[key] = value
+      else if (mode == "names") section[key] = value
+      else if (mode == "labels") label[key] = value
+    }
+  }
+  close(file)
+  for (key in section) {
+    nm = section[key]
+    if (!(nm in labels)) labels[nm] = label[key]
+    n = chars(content[key], list)
+    for (j = 1; j <= n; j++) {
+      c = list[j]
+      if (!((nm, c) in have)) {
+        have[nm, c] = 1
+        letters[nm] = letters[nm] c "\n"
+      }
+      file = dir "/" nm "_" (j - 1) ".js"
+      if (page == "" && (getline line < (dir "/" nm "_" (j - 1) ".html")) > 0) {
+        close(dir "/" nm "_" (j - 1) ".html")
+        page = dir "/" nm "_" (j - 1) ".html"
+      }
+      while ((getline line < file) > 0) {
+        # ['id',['name',['url',1,'scope'],['url',1,'scope']]],
+        if (line !~ /^[ \t]*\['/) continue
+        sub(/^[ \t]*\['/, "", line)
+        sub(/,[ \t]*$/, "", line)
+        sub(/\]\]$/, "", line)
+        i = index(line, "',['")
+        id = substr(line, 1, i - 1)
+        rest = substr(line, i + 4)
+        # The name runs up to the first quote that is not escaped
+        for (i = 1; i <= length(rest); i++) {
+          t = substr(rest, i, 1)
+          if (t == "\\") i++
+          else if (t == "'") break
+        }
+        name = substr(rest, 1, i - 1)
+        rest = substr(rest, i + 2)
+        sub(/_[0-9]+$/, "", id)
+        k = nm SUBSEP c SUBSEP name
+        if (!(k in entry)) {
+          entry[k] = ""
+          ids[k] = id
+          entries[nm, c] = entries[nm, c] name "\n"
+        }
+        n2 = split(rest, targets, /'\],\['/)
+        for (t = 1; t <= n2; t++) {
+          if (t > 1) targets[t] = "['" targets[t]
+          if (t < n2) targets[t] = targets[t] "']"
+          url = targets[t]
+          sub(/^\['/, "", url)
+          sub(/',.*/, "", url)
+          if ((k, move(url, prefix)) in seen) continue
+          seen[k, move(url, prefix)] = 1
+          entry[k] = entry[k] (entry[k] == "" ? "" : ",") "['" move(url, prefix) substr(targets[t], length(url) + 3)
+        }
+      }
+      close(file)
+    }
+  }
+}
+
+# Sorts the lines of a short list (the letters of a section) in place by
+# byte value, returns how many
+function sorted(s, list, n, i, j, v) {
+  n = split(s, list, "\n") - 1
+  for (i = 2; i <= n; i++) {
+    v = list[i]
+    for (j = i - 1; j > 0 && list[j] > v; j--) list[j + 1] = list[j]
+    list[j + 1] = v
+  }
+  return n
+}
+
+function finish(i, nm, n, j, list, m, k, name, line, at, withContent, sectionNames, sectionLabels, s, key) {
+  for (nm in letters) if (!(nm in known)) names[++nnames] = nm
+  at = 0
+  for (i = 1; i <= nnames; i++) {
+    nm = names[i]
+    if (!(nm in letters)) continue
+    n = sorted(letters[nm], list)
+    s = ""
+    for (j = 1; j <= n; j++) {
+      s = s list[j]
+      m = split(entries[nm, list[j]], name, "\n") - 1
+      for (k = 1; k <= m; k++) {
+        key = nm SUBSEP list[j] SUBSEP name[k]
+        printf "%s_%d\t%s\t%s\t['%s',%s]\n", nm, j - 1, tolower(name[k]), ids[key], name[k], entry[key]
+      }
+    }
+    gsub(/\\/, "&&", s)
+    gsub(/"/, "\\\"", s)
+    withContent = withContent (at ? ",\n" : "") "  " at ": \"" s "\""
+    sectionNames = sectionNames (at ? ",\n" : "") "  " at ": \"" nm "\""
+    sectionLabels = sectionLabels (at ? ",\n" : "") "  " at ": \"" labels[nm] "\""
+    at++
+  }
+  printf "var indexSectionsWithContent =\n{\n%s\n};\n\nvar indexSectionNames =\n{\n%s\n};\n\nvar indexSectionLabels =\n{\n%s\n};\n\n",
+    withContent, sectionNames, sectionLabels > searchdata
+  if (page != "") while ((getline line < page) > 0) print line > template
+}
@@ -0,0 +1,156 @@
+#!/usr/bin/env sh
+
+# Merges the symbol lists of several sites (tools/mkSymbols.sh) into one
+# federated index for src/js/federatedSearch.js, and writes its page,
+# federated.html, into the site the index is put in (the parent of the
+# out dir). Each project is a name, the url of its html dir relative to
+# that page (or absolute) and its symbols.txt. A symbol listed by more
+# than one project, same kind and name, is kept for the first one given,
+# with all of its overloads there.
+#
+# Symbols are numbered classes first, then namespaces, then members, each
+# in order of their last name component, so similar names end up in the
+# same chunks of
+#   kind protection TAB qualified name TAB project TAB url
+# and their trigrams (numbered as in src/js/fuzzySearch.js) are spread
+# over shards by a multiplicative hash. Each line of a shard is
+#   trigram symbol symbol ...
+# all in base 36, symbol numbers delta encoded. A query fetches the shards
+# of its own trigrams and the few chunks holding its best candidates.
+# Trigrams in more than an eighth of all names are listed in meta.json,
+# queries with enough rarer ones leave their shards alone.
+# Usage: mergeSymbols.sh <out dir> <name> <url> <symbols.txt> [<name> <url> <symbols.txt>]...
+usage="Usage: $0 <out dir> <name> <url> <symbols.txt> [<name> <url> <symbols.txt>]..."
+out=${1:?"$usage"}
+shift
+[ $# -ge 3 ] && [ $(($# % 3)) -eq 0 ] || { echo "$usage" >&2; exit 1; }
+here=$(cd "$(dirname "$0")" && pwd)
+. "$here/config.sh"
+chunk=1024
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+# Project names and urls for meta.json, lists with the project number
+n=$(($# / 3))
+p=0
+while [ "$p" -lt "$n" ]; do
+  [ -f "$3" ] || { echo "No symbols in $3" >&2; exit 1; }
+  case $2 in
+    "" | */) url=$2 ;;
+    *) url=$2/ ;;
+  esac
+  printf '%s\t%s\n' "$1" "$url" >> "$tmp/projects"
+  set -- "$@" "p=$p" "$3"
+  shift 3
+  p=$((p + 1))
+done
+for js in fuzzySearch federatedSearch; do
+  [ -f "$here/../src/js/$js.js" ] && cp "$here/../src/js/$js.js" "$tmp" || cp "$here/../js/$js.js" "$tmp"
+done
+
+# Sort key (0, 1 or 2 and the last name component), lower cased name, then
+# the line
+LC_ALL=C awk -F '\t' -v OFS='\t' '
+  NF < 3 { next }
+  {
+    key = substr($1, 1, 1) $2
+    if (!(key in owner)) owner[key] = p
+  }
+  owner[key] == p {
+    lower = last = tolower($2)
+    while ((i = index(last, "::")) > 0) last = substr(last, i + 2)
+    k = substr($1, 1, 1)
+    print (k == "c" ? 0 : k == "n" ? 1 : 2) last, lower, $1, $2, p, $3
+  }
+' "$@" | LC_ALL=C sort -t "$(printf '\t')" -k1,1 -k2,2 > "$tmp/all"
+symbols=$(wc -l < "$tmp/all")
+[ "$symbols" -gt 0 ] || { echo "No symbols to merge"; exit 1; }
+# About 128 symbols' worth of postings per shard
+shards=1
+while [ "$shards" -lt 4096 ] && [ $((shards * 128)) -lt "$symbols" ]; do shards=$((shards * 2)); done
+rm -rf "$out"
+mkdir -p "$out/grams"
+
+# Chunks and the first sort key of each, one line per trigram and symbol
+LC_ALL=C awk -F '\t' -v out="$out" -v chunk="$chunk" -v shards="$shards" -v heads="$tmp/heads" '
+  BEGIN { for (i = 1; i < 256; i++) ord[sprintf("%c", i)] = i < 128 ? i : 127 }
+  {
+    id = NR - 1
+    if (id % chunk == 0) {
+      if (file) close(file)
+      file = out "/symbols." int(id / chunk) ".txt"
+      print $1 > heads
+    }
+    print $3 "\t" $4 "\t" $5 "\t" $6 > file
+    split("", done)
+    for (i = 1; i + 2 <= length($2); i++) {
+      code = ord[substr($2, i, 1)] * 16384 + ord[substr($2, i + 1, 1)] * 128 + ord[substr($2, i + 2, 1)]
+      # The top bits of code * 2^32 / golden ratio, mod 2^32
+      if (!done[code]++) print int(code * 2654435761 % 4294967296 / (4294967296 / shards)) "\t" code "\t" id
+    }
+  }
+' "$tmp/all" | LC_ALL=C sort -t "$(printf '\t')" -k1,1n -k2,2n -k3,3n > "$tmp/postings"
+
+awk -F '\t' -v out="$out" -v common="$(( symbols / 8 ))" '
+  function b36(n, s) {
+    s = ""
+    do { s = substr("0123456789abcdefghijklmnopqrstuvwxyz", n % 36 + 1, 1) s; n = int(n / 36) } while (n > 0)
+    return s
+  }
+  function flush() {
+    if (code == "") return
+    print b36(code) line > file
+    if (count > common) print code > "/dev/stderr"
+  }
+  $1 != shard || $2 != code {
+    flush()
+    if ($1 != shard || file == "") {
+      if (file) close(file)
+      shard = $1
+      file = out "/grams/" shard ".txt"
+    }
+    code = $2
+    line = ""
+    prev = count = 0
+  }
+  {
+    line = line " " b36($3 - prev)
+    prev = $3
+    count++
+  }
+  END { flush() }
+' "$tmp/postings" 2> "$tmp/common"
+
+awk -v symbols="$symbols" -v shards="$shards" -v chunk="$chunk" -v heads="$tmp/heads" -v common="$tmp/common" '
+  function json(s) {
+    # "&&" doubles the backslash in every awk, "\\\\" only in some
+    gsub(/\\/, "&&", s)
+    gsub(/"/, "\\\"", s)
+    return "\"" s "\""
+  }
+  BEGIN { FS = "\t" }
+  { projects = projects (NR > 1 ? ", " : "") "{\"name\": " json($1) ", \"url\": " json($2) "}" }
+  END {
+    while ((getline head < heads) > 0) list = list (list == "" ? "" : ", ") json(head)
+    while ((getline code < common) > 0) codes = codes (codes == "" ? "" : ", ") code
+    printf "{\"symbols\": %d, \"shards\": %d, \"chunk\": %d, \"common\": [%s],\n \"projects\": [%s],\n \"heads\": [%s]}\n",
+      symbols, shards, chunk, codes, projects, list
+  }
+' "$tmp/projects" > "$out/meta.json"
+cp "$tmp/fuzzySearch.js" "$tmp/federatedSearch.js" "$out"
+
+dir=$(basename "$out")
+cat > "$tmp/body" <<EOF
+<div class="header"><div class="headertitle"><div class="title">Symbols in all projects</div></div></div>
+<div class="contents">
+<form class="fulltext-form" action="federated.html">
+<input type="search" name="q" id="symbol-query" placeholder="Find a class or member in any project" autocomplete="off" data-federated=""/>
+</form>
+<p id="symbol-status"></p>
+<ol id="symbol-results"></ol>
+</div>
+<script type="text/javascript" src="$dir/fuzzySearch.js"></script>
+<script type="text/javascript" src="$dir/federatedSearch.js"></script>
+EOF
+sitePage "$(dirname "$out")" federated.html "$tmp/body"
+echo "Merged $symbols symbols from $(wc -l < "$tmp/projects") projects, $(wc -l < "$tmp/postings") postings in $shards shards ($(du -sh "$out" | cut -f1))"
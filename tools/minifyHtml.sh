@@ -0,0 +1,141 @@
+#!/usr/bin/env sh
+
+# Minifies every page of a generated site in place: drops comments (the
+# license headers of the templates among them), collapses indentation and
+# whitespace, removes the whitespace doxygen leaves between block tags and
+# shortens default and boolean attributes. pre, script, style, textarea
+# and the div.line code lines are copied as they are. The markers the
+# other tools look for (header / footer parts, contents) are kept, still
+# best run last.
+# Usage: minifyHtml.sh <html dir>
+if [ "$1" = "--pages" ]; then
+  shift
+  for page; do
+    # A record per "<", the page is written out as it is read
+    awk -v RS="<" '
+      BEGIN {
+        n = split("address article aside blockquote body br caption col colgroup dd details dir div dl dt fieldset figcaption figure footer form h1 h2 h3 h4 h5 h6 head header hr html iframe li link main meta nav noscript ol option p pre script section style summary table tbody td tfoot th thead title tr ul", b, " ")
+        for (i = 1; i <= n; i++) block[b[i]] = 1
+        n = split("async checked defer disabled hidden multiple nowrap open readonly selected", b, " ")
+        for (i = 1; i <= n; i++) boolean[b[i]] = 1
+        keep = "^<!-- (end header part|start footer part|contents) -->$"
+        leading = 1
+      }
+      function name_of(tag) {
+        sub(/^\//, "", tag)
+        match(tag, /^[a-zA-Z][a-zA-Z0-9]*/)
+        return tolower(substr(tag, 1, RLENGTH))
+      }
+      function attrs(tag, a) {
+        if (tag ~ /^(script|link|style)[ \t\n]/) {
+          sub(/[ \t\n]+type="text\/(javascript|css)"/, "", tag)
+        }
+        for (a in boolean) {
+          sub("[ \t\n]+" a "=\"(" a ")?\"", " " a, tag)
+        }
+        gsub(/[ \t\n]+/, " ", tag)
+        sub(/ \/>$/, "/>", tag)
+        sub(/ >$/, ">", tag)
+        return tag
+      }
+      function spaces(text) {
+        gsub(/[ \t\r]*\n[ \t\r\n]*/, "\n", text)
+        gsub(/[ \t]+/, " ", text)
+        return text
+      }
+      # Prints, without the whitespace the page starts with
+      function put(text) {
+        if (!started) {
+          sub(/^[ \n]+/, "", text)
+          if (text == "") return
+          started = 1
+        }
+        printf "%s", text
+      }
+      # Markup outside of the preserved elements and comments goes in runs:
+      # the text before the first tag (lead) until that tag is seen, then
+      # each tag with the text after it (piece) until the next, as
+      # whitespace next to a block tag never renders
+      function more(t) {
+        if (leading) lead = lead t
+        else piece = piece t
+      }
+      # Prints the held tag, now that whether a block follows is known
+      function release(next_block, gt, rest) {
+        piece = spaces(piece)
+        gt = index(piece, ">")
+        rest = substr(piece, gt + 1)
+        if (rest ~ /^[ \n]*$/ && (block[name_of(piece)] || next_block)) rest = ""
+        put("<" attrs(substr(piece, 1, gt)) rest)
+      }
+      function tag(t) {
+        if (leading) {
+          lead = spaces(lead)
+          if (!(lead ~ /^[ \n]*$/ && block[name_of(t)])) put(lead)
+          leading = 0
+        } else release(block[name_of(t)])
+        piece = t
+      }
+      # Ends a run, before says whether a block follows it
+      function flush(before) {
+        if (leading) {
+          lead = spaces(lead)
+          if (!(before && lead ~ /^[ \n]*$/)) put(lead)
+        } else release(before)
+        lead = piece = ""
+        leading = 1
+      }
+      # Once the comment is complete, keeps the markers and goes on with
+      # the text after it
+      function comment_end(end) {
+        end = index(comment, "-->")
+        if (!end) return
+        if (substr(comment, 1, end + 2) ~ keep) {
+          flush(1)
+          put(substr(comment, 1, end + 2))
+        }
+        more(substr(comment, end + 3))
+        state = ""
+      }
+      NR == 1 { lead = $0; next }
+      state == "comment" { comment = comment "<" $0; comment_end(); next }
+      state == "raw" {
+        if (index($0, close_tag) != 1) { printf "<%s", $0; next }
+        state = ""
+      }
+      /^!--/ { comment = "<" $0; state = "comment"; comment_end(); next }
+      /^(pre|script|style|textarea)[ \t\n>]|^div class="line"[ >]/ {
+        # Opening tag squeezed, the rest up to the closing tag as is
+        # (div.line only ever holds spans, its first </div> is its own)
+        flush($0 !~ /^textarea/)
+        gt = index($0, ">")
+        close_tag = "/" name_of($0) ">"
+        put("<" attrs(substr($0, 1, gt)) substr($0, gt + 1))
+        state = "raw"
+        next
+      }
+      { tag($0) }
+      END { if (state != "raw") flush(1) }
+    ' "$page" > "$page.min" || { rm -f "$page.min"; continue; }
+    before=$(wc -c < "$page")
+    after=$(wc -c < "$page.min")
+    if [ "$after" -lt "$before" ]; then
+      mv "$page.min" "$page"
+    else
+      rm -f "$page.min"
+      after=$before
+    fi
+    echo "$before $after"
+  done
+  exit
+fi
+
+html=${1:?"Usage: $0 <html dir>"}
+jobs=$(nproc 2>/dev/null || echo 4)
+find "$html" -type f -name '*.html' | xargs -n 64 -P "$jobs" sh "$0" --pages |
+  awk '{ before += $1; after += $2; pages++ }
+    END {
+      if (!pages) { print "No pages"; exit }
+      printf "Minified %d pages, %d bytes down to %d (%d saved, %.1f%%)\n",
+        pages, before, after, before - after, before ? 100 * (before - after) / before : 0
+    }'
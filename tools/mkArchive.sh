@@ -0,0 +1,16 @@
+#!/usr/bin/env sh
+
+# Packs a generated site into one zip file, entries sorted by path and
+# deflated once up front, for tools/zipServe.py to serve as is.
+# Usage: mkArchive.sh <html dir> <archive.zip>
+html=${1:?"Usage: $0 <html dir> <archive.zip>"}
+archive=${2:?"Usage: $0 <html dir> <archive.zip>"}
+case $archive in
+  /*) ;;
+  *) archive=$(pwd)/$archive ;;
+esac
+rm -f "$archive"
+# Images and fonts are compressed already
+(cd "$html" && find . -type f | sed 's|^\./||' | LC_ALL=C sort |
+  zip -q -9 -X -n .png:.jpg:.gif:.woff:.woff2:.gz:.br -@ "$archive")
+echo "Packed $(unzip -Z1 "$archive" | wc -l) files into $archive ($(du -h "$archive" | cut -f1))"
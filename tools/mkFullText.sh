@@ -0,0 +1,116 @@
+#!/usr/bin/env sh
+
+# Builds a full text index over the descriptions and pages in doxygen's
+# XML output (GENERATE_XML = YES) for src/js/fullText.js, and a
+# fulltext.html search page (fulltext.html?q=... works too) next to the
+# html pages. Terms are spread over shards by a hash of the term, so a
+# query only fetches the shards of its own terms. Each line of a shard is
+#   term doc,weight doc,weight ...
+# with doc ids delta encoded and both numbers in base 36. The weight is the
+# document side of BM25 (term frequency against document length) times
+# 100, the client adds the idf from the number of postings.
+# Usage: mkFullText.sh <xml dir> <html dir> [shards]
+if [ "$1" = "--files" ]; then
+  tmp=$2
+  shift 2
+  awk -f "$(dirname "$0")/fullText.awk" "$@" > "$tmp/docs.$$"
+  exit
+fi
+
+xml=${1:?"Usage: $0 <xml dir> <html dir> [shards]"}
+html=${2:?"Usage: $0 <xml dir> <html dir> [shards]"}
+shards=$3
+here=$(cd "$(dirname "$0")" && pwd)
+. "$here/config.sh"
+js=$here/../src/js/fullText.js
+[ -f "$js" ] || js=$here/../js/fullText.js
+jobs=$(nproc 2>/dev/null || echo 4)
+out=$html/fulltext
+chunk=1024
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+sed -n 's/.*<compound refid="\([^"]*\)".*/\1/p' "$xml/index.xml" | sed "s|^|$xml/|; s|$|.xml|" |
+  xargs -n 64 -P "$jobs" sh "$here/mkFullText.sh" --files "$tmp"
+# Namespace members are in the XML of their files as well, same url
+cat "$tmp"/docs.* | awk -F '\t' '!seen[$1]++' > "$tmp/all"
+docs=$(wc -l < "$tmp/all")
+[ "$docs" -gt 0 ] || { echo "Nothing documented in $xml"; exit 1; }
+# About 128 documents' worth of postings per shard
+if [ -z "$shards" ]; then
+  shards=1
+  while [ "$shards" -lt 1024 ] && [ $((shards * 128)) -lt "$docs" ]; do shards=$((shards * 2)); done
+fi
+rm -rf "$out"
+mkdir -p "$out"
+
+# Doc tables in chunks, and one line per term and doc for the postings
+awk -F '\t' -v out="$out" -v chunk="$chunk" -v shards="$shards" -v meta="$tmp/meta" '
+  BEGIN { for (i = 0; i < 128; i++) ord[sprintf("%c", i)] = i }
+  function shard(term, h, i) {
+    h = 0
+    for (i = 1; i <= length(term); i++) h = (h * 31 + ord[substr(term, i, 1)]) % shards
+    return h
+  }
+  {
+    id = NR - 1
+    file = out "/docs." int(id / chunk) ".txt"
+    if (file != last) { if (last) close(last); last = file }
+    print $1 "\t" $2 > file
+    n = split($3, w, " ")
+    total += n
+    split("", tf)
+    for (i = 1; i <= n; i++) tf[w[i]]++
+    for (t in tf) print shard(t) "\t" t "\t" id "\t" tf[t] "\t" n
+  }
+  END { print NR, total / NR > meta }
+' "$tmp/all" | LC_ALL=C sort -t "$(printf '\t')" -k1,1n -k2,2 -k3,3n > "$tmp/postings"
+read -r docs avgdl < "$tmp/meta"
+
+awk -F '\t' -v out="$out" -v avgdl="$avgdl" '
+  function b36(n, s) {
+    s = ""
+    do { s = substr("0123456789abcdefghijklmnopqrstuvwxyz", n % 36 + 1, 1) s; n = int(n / 36) } while (n > 0)
+    return s
+  }
+  function flush() {
+    if (term != "") print term line > file
+  }
+  $1 != shard || $2 != term {
+    flush()
+    if ($1 != shard || file == "") {
+      if (file) close(file)
+      shard = $1
+      file = out "/" shard ".txt"
+    }
+    term = $2
+    line = ""
+    prev = 0
+  }
+  {
+    # BM25 with k1 = 1.2 and b = 0.75
+    weight = int(100 * $4 * 2.2 / ($4 + 1.2 * (0.25 + 0.75 * $5 / avgdl)) + 0.5)
+    line = line " " b36($3 - prev) "," b36(weight)
+    prev = $3
+    postings++
+  }
+  END { flush(); print postings > "/dev/stderr" }
+' "$tmp/postings" 2> "$tmp/count"
+
+printf '{"docs": %d, "shards": %d, "chunk": %d}\n' "$docs" "$shards" "$chunk" > "$out/meta.json"
+cp "$js" "$out"
+
+# The search page, in the site's own header and footer
+cat > "$tmp/body" <<'EOF'
+<div class="header"><div class="headertitle"><div class="title">Search</div></div></div>
+<div class="contents">
+<form class="fulltext-form" action="fulltext.html">
+<input type="search" name="q" id="fulltext-query" placeholder="Search the documentation" autocomplete="off"/>
+</form>
+<p id="fulltext-status"></p>
+<ol id="fulltext-results"></ol>
+</div>
+<script type="text/javascript" src="fulltext/fullText.js"></script>
+EOF
+sitePage "$html" fulltext.html "$tmp/body"
+echo "Indexed $docs documents, $(cat "$tmp/count") postings in $shards shards ($(du -sh "$out" | cut -f1))"
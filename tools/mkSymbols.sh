@@ -0,0 +1,87 @@
+#!/usr/bin/env sh
+
+# Lists every class, namespace and member in a doxygen tag file
+# (GENERATE_TAGFILE) for the typo tolerant symbol search in
+# src/js/fuzzySearch.js, and writes its page, symbols.html (also as
+# symbols.html?q=...), next to the html pages. One symbol per line,
+#   kind protection TAB qualified name TAB url
+# sorted the way ties are ranked: classes first and public first.
+# Usage: mkSymbols.sh <tag file> <html dir>
+tags=${1:?"Usage: $0 <tag file> <html dir>"}
+html=${2:?"Usage: $0 <tag file> <html dir>"}
+here=$(cd "$(dirname "$0")" && pwd)
+. "$here/config.sh"
+js=$here/../src/js/fuzzySearch.js
+[ -f "$js" ] || js=$here/../js/fuzzySearch.js
+out=$html/symbols
+mkdir -p "$out"
+
+# Overloads share a rank and name, only the same anchor twice is dropped
+awk '
+  BEGIN {
+    split("class:c struct:c union:c interface:c protocol:c concept:c namespace:n enumeration:e enum:e typedef:t function:f signal:f slot:f friend:f variable:v property:v enumvalue:v define:d", t, " ")
+    for (i = 1; i in t; i++) { split(t[i], kv, ":"); kind[kv[1]] = kv[2] }
+    prot["public"] = 0; prot["protected"] = 1; prot["private"] = 2
+  }
+  function value(tag, s) {
+    s = $0
+    sub("^[ \t]*<" tag ">", "", s)
+    sub("</" tag ">.*$", "", s)
+    gsub(/&lt;/, "<", s); gsub(/&gt;/, ">", s); gsub(/&amp;/, "\\&", s)
+    return s
+  }
+  function html(file) { return file ~ /\.[a-z]+$/ ? file : file ".html" }
+  # The rank lines are sorted by, then the line itself
+  function symbol(k, p, name, url) {
+    if (k == "" || name == "" || url == "") return
+    print (k == "c" ? 0 : k == "n" ? 1 : 2) p "\t" k p "\t" name "\t" url
+  }
+  /^  <compound / {
+    match($0, /kind="[^"]*"/)
+    ckind = substr($0, RSTART + 6, RLENGTH - 7)
+    cname = cfile = ""
+    depth = 1
+    next
+  }
+  /^  <\/compound>/ {
+    symbol(kind[ckind], 0, cname, html(cfile))
+    depth = 0
+    next
+  }
+  depth == 1 && /^    <name>/ { cname = value("name"); next }
+  depth == 1 && /^    <filename>/ { cfile = value("filename"); next }
+  /^    <member / {
+    match($0, /kind="[^"]*"/)
+    mkind = substr($0, RSTART + 6, RLENGTH - 7)
+    mprot = 0
+    if (match($0, /protection="[^"]*"/)) mprot = prot[substr($0, RSTART + 12, RLENGTH - 13)]
+    mname = mfile = manchor = ""
+    depth = 2
+    next
+  }
+  depth == 2 && /^      <name>/ { mname = value("name"); next }
+  depth == 2 && /^      <anchorfile>/ { mfile = value("anchorfile"); next }
+  depth == 2 && /^      <anchor>/ { manchor = value("anchor"); next }
+  /^    <\/member>/ {
+    # Members of files and groups are known by their own names
+    qualified = (ckind == "class" || ckind == "struct" || ckind == "union" || ckind == "namespace" || ckind == "interface") ? cname "::" mname : mname
+    symbol(kind[mkind], mprot, qualified, html(mfile) "#" manchor)
+    depth = 1
+  }
+' "$tags" | LC_ALL=C sort -t "$(printf '\t')" -k1,1n -k3,3 -k4,4 -u | cut -f2- > "$out/symbols.txt"
+cp "$js" "$out"
+
+cat > "$out/.body" <<'EOF'
+<div class="header"><div class="headertitle"><div class="title">Symbols</div></div></div>
+<div class="contents">
+<form class="fulltext-form" action="symbols.html">
+<input type="search" name="q" id="symbol-query" placeholder="Find a class or member, typos and all" autocomplete="off"/>
+</form>
+<p id="symbol-status"></p>
+<ol id="symbol-results"></ol>
+</div>
+<script type="text/javascript" src="symbols/fuzzySearch.js"></script>
+EOF
+sitePage "$html" symbols.html "$out/.body"
+rm -f "$out/.body"
+echo "Listed $(wc -l < "$out/symbols.txt") symbols in $out/symbols.txt"
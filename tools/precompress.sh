@@ -0,0 +1,25 @@
+#!/usr/bin/env sh
+
+# Writes gzip (and brotli, when installed) copies next to every text file
+# of a generated site, for servers which send precompressed files as they
+# are (gzip_static in tools/nginx.conf). Only stale copies are redone.
+# Usage: precompress.sh <html dir>
+if [ "$1" = "--files" ]; then
+  shift
+  for file; do
+    [ "$file.gz" -nt "$file" ] || gzip -9 -n -k -f "$file"
+    if command -v brotli > /dev/null; then
+      [ "$file.br" -nt "$file" ] || brotli -q 11 -k -f "$file"
+    fi
+  done
+  exit
+fi
+
+html=${1:?"Usage: $0 <html dir>"}
+jobs=$(nproc 2>/dev/null || echo 4)
+find "$html" -type f \( -name '*.html' -o -name '*.css' -o -name '*.js' \
+  -o -name '*.svg' -o -name '*.json' -o -name '*.map' -o -name '*.xml' \) -size +1k |
+  xargs -n 128 -P "$jobs" sh "$0" --files
+raw=$(find "$html" -type f -name '*.gz' | sed 's/\.gz$//' | xargs cat | wc -c)
+gz=$(find "$html" -type f -name '*.gz' -exec cat {} + | wc -c)
+echo "Precompressed $(find "$html" -name '*.gz' | wc -l) files, $raw bytes down to $gz gzipped"
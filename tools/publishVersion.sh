@@ -0,0 +1,90 @@
+#!/usr/bin/env sh
+
+# Publishes a generated site as one of many versions, under a root laid
+# out as
+#   <root>/store/objects/ab/cdef...  every distinct file once, by sha256
+#   <root>/<version>/...             the site, hard links into the store
+#   <root>/versions.json             for the version switcher in header.html
+# Pages get a <meta name="doxyYoda-versions"> on the way in, and only
+# pages with it look for versions.json.
+# Files already in the store, which are most pages of a version next to
+# the last one, are only linked, so publishing writes just the pages that
+# changed. Publishing a version again drops what it no longer has, and
+# objects no version links to any more are removed. Keep the links when
+# copying the root elsewhere (rsync -H, tar).
+# Usage: publishVersion.sh <html dir> <root> <version>
+if [ "$1" = "--files" ]; then
+  root=$2
+  version=$3
+  shift 3
+  # w for files new to the store, l for ones linked in from it, and s
+  # for ones this version already had
+  tmp=$root/store/.page.$$
+  for file; do
+    src=$file
+    case $file in
+      *.html)
+        awk '/name="doxyYoda-versions"/ { done = 1 } /<\/head>/ && !done { sub(/<\/head>/, "<meta name=\"doxyYoda-versions\" content=\"../versions.json\"/></head>"); done = 1 } { print }' \
+          "$file" > "$tmp"
+        src=$tmp
+        ;;
+    esac
+    hash=$(sha256sum < "$src")
+    hash=${hash%% *}
+    object=$root/store/objects/${hash%"${hash#??}"}/${hash#??}
+    page=$root/$version/$file
+    if [ "$page" -ef "$object" ]; then
+      echo s
+      continue
+    fi
+    if [ -f "$object" ]; then
+      echo l
+    else
+      mkdir -p "$(dirname "$object")"
+      cp "$src" "$object.$$" && mv -f "$object.$$" "$object"
+      echo w
+    fi
+    mkdir -p "$(dirname "$page")"
+    ln -f "$object" "$page"
+  done
+  rm -f "$tmp"
+  exit
+fi
+
+usage="Usage: $0 <html dir> <root> <version>"
+html=${1:?"$usage"}
+root=${2:?"$usage"}
+version=${3:?"$usage"}
+case $version in
+  store | */* | .*) echo "Not a version name: $version" >&2; exit 1 ;;
+esac
+here=$(cd "$(dirname "$0")" && pwd)
+jobs=$(nproc 2>/dev/null || echo 4)
+mkdir -p "$root/store/objects" "$root/$version"
+root=$(cd "$root" && pwd)
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+cd "$html" || exit 1
+find . -type f | sed 's|^\./||' | LC_ALL=C sort > "$tmp/pages"
+tr '\n' '\0' < "$tmp/pages" | xargs -0 -n 256 -P "$jobs" sh "$here/publishVersion.sh" --files "$root" "$version" |
+  awk '{ n[$1]++ } END { printf "%d %d %d\n", n["w"], n["l"], n["s"] }' > "$tmp/counts"
+read -r written linked same < "$tmp/counts"
+
+# Pages gone since the version was last published, and objects nothing
+# links to any more
+(cd "$root/$version" && find . -type f | sed 's|^\./||' | LC_ALL=C sort) |
+  LC_ALL=C comm -13 "$tmp/pages" - | tr '\n' '\0' | (cd "$root/$version" && xargs -0 rm -f)
+find "$root/$version" -mindepth 1 -type d -empty -delete
+find "$root/store/objects" -type f -links 1 -delete
+find "$root/store/objects" -mindepth 1 -type d -empty -delete
+
+# Newest version first
+find "$root" -mindepth 1 -maxdepth 1 -type d ! -name store -exec basename {} \; | sort -V -r |
+  awk '
+    { list = list (NR > 1 ? ", " : "") "\"" $0 "\"" }
+    NR == 1 { latest = $0 }
+    END { printf "{\"latest\": \"%s\", \"versions\": [%s]}\n", latest, list }
+  ' > "$root/versions.json"
+echo "Published $version: $written files written, $linked linked from other versions, $same unchanged" \
+  "($(du -sh "$root/store" | cut -f1) stored for $(sed -n 's/.*"versions": \[\(.*\)\]}/\1/p' "$root/versions.json" | tr ',' '\n' | wc -l) versions)"
@@ -0,0 +1,111 @@
+# Swaps the header and footer of pages doxygen has already written for
+# freshly expanded ones. The old header runs up to <!-- end header part -->
+# and the old footer starts at <!-- start footer part -->. Settings come
+# from the YODA_* environment set by tools/reTemplate.sh. Needs
+# tools/template.awk.
+
+function relative(file,    rel, depth) {
+  rel = substr(file, length(root) + 2)
+  return gsub(/\//, "/", rel)
+}
+
+function dots(depth,    s) {
+  s = ""
+  while (depth-- > 0) s = s "../"
+  return s
+}
+
+# The header and footer only differ by depth, apart from $title and $navpath
+function templates(depth,    rel, s, i, n, css) {
+  if (depth in heads) return
+  rel = dots(depth)
+  tok["relpath"] = rel
+  tok["search"] = ""
+  if (enabled("SEARCHENGINE"))
+    tok["search"] = "<link href=\"" rel "search/search.css\" rel=\"stylesheet\" type=\"text/css\"/>\n" \
+      "<script type=\"text/javascript\" src=\"" rel "search/searchdata.js\"></script>\n" \
+      "<script type=\"text/javascript\" src=\"" rel "search/search.js\"></script>"
+  tok["treeview"] = ""
+  if (enabled("GENERATE_TREEVIEW"))
+    tok["treeview"] = "<link href=\"" rel "navtree.css\" rel=\"stylesheet\" type=\"text/css\"/>\n" \
+      "<script type=\"text/javascript\" src=\"" rel "resize.js\"></script>\n" \
+      "<script type=\"text/javascript\" src=\"" rel "navtreedata.js\"></script>\n" \
+      "<script type=\"text/javascript\" src=\"" rel "navtree.js\"></script>"
+  s = ""
+  n = split(ENVIRON["YODA_stylesheets"], css, " ")
+  for (i = 1; i <= n; i++)
+    s = s "<link href=\"" rel css[i] "\" rel=\"stylesheet\" type=\"text/css\"/>\n"
+  tok["extrastylesheet"] = s
+  heads[depth] = expand(header)
+  foots[depth] = expand(footer)
+}
+
+function between(s, from, to,    i) {
+  if (!(i = index(s, from))) return ""
+  s = substr(s, i + length(from))
+  return (i = index(s, to)) ? substr(s, 1, i - 1) : ""
+}
+
+# The footer template's own leading comments come before its marker, so
+# whole line comments are taken off the end of the body too
+function trim(body,    i, last, off, rest) {
+  for (;;) {
+    sub(/[ \t\n]+$/, "", body)
+    if (body !~ /-->$/) return body
+    last = off = 0
+    rest = body
+    while ((i = index(rest, "<!--")) > 0) {
+      last = off + i
+      off += i
+      rest = substr(rest, i + 1)
+    }
+    if (last < 2 || substr(body, last - 1, 1) != "\n") return body
+    body = substr(body, 1, last - 1)
+  }
+}
+
+function finish(    end, head, foot, body, title, navpath, depth, prefix) {
+  end = "<!-- end header part -->"
+  head = index(page, end)
+  foot = index(page, "<!-- start footer part -->")
+  if (!head || foot < head) {
+    print "Skipping " out ", no header and footer markers" > "/dev/stderr"
+    return
+  }
+  title = between(page, "<title>", "</title>")
+  prefix = tok["projectname"] ": "
+  if (index(title, prefix) == 1) title = substr(title, length(prefix) + 1)
+  navpath = between(substr(page, foot), "<ul>", "<li class=\"footer\">")
+  sub(/^[ \t\n]+/, "", navpath)
+  sub(/[ \t\n]+$/, "", navpath)
+  body = trim(substr(page, head + length(end), foot - head - length(end)))
+  sub(/^\n/, "", body)
+
+  depth = relative(out)
+  templates(depth)
+  printf "%s%s\n%s", replace(heads[depth], "\001", title), body,
+    replace(foots[depth], "\002", navpath) > out
+  close(out)
+}
+
+BEGIN {
+  root = ENVIRON["YODA_root"]
+  split("projectname projectnumber projectbrief projectlogo doxygenversion", t)
+  for (i = 1; i in t; i++) tok[t[i]] = ENVIRON["YODA_" t[i]]
+  tok["generatedby"] = "Generated by"
+  tok["title"] = "\001"
+  tok["navpath"] = "\002"
+  flags = ENVIRON["YODA_flags"]
+  header = slurp(ENVIRON["YODA_header"])
+  footer = slurp(ENVIRON["YODA_footer"])
+}
+
+FNR == 1 {
+  if (out) finish()
+  out = FILENAME
+  page = ""
+}
+
+{ page = page $0 "\n" }
+
+END { if (out) finish() }
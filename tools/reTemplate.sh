@@ -0,0 +1,59 @@
+#!/usr/bin/env sh
+
+# Puts the current header.html and footer.html on pages doxygen has
+# already written, without running doxygen again. The project settings
+# are read from the Doxyfile. All cores are used.
+# Usage: reTemplate.sh <Doxyfile> [html dir]
+doxyfile=${1:?"Usage: $0 <Doxyfile> [html dir]"}
+here=$(cd "$(dirname "$0")" && pwd)
+. "$here/config.sh"
+cd "$(dirname "$doxyfile")" || exit 1
+doxyfile=$(basename "$doxyfile")
+jobs=$(nproc 2>/dev/null || echo 4)
+
+html=$2
+if [ -z "$html" ]; then
+  html=$(doxyval "$doxyfile" HTML_OUTPUT)
+  html=${html:-html}
+  case $html in
+    /*) ;;
+    *) outdir=$(doxyval "$doxyfile" OUTPUT_DIRECTORY); html=${outdir:-.}/$html ;;
+  esac
+fi
+
+YODA_root=${html%/}
+YODA_header=$(doxyval "$doxyfile" HTML_HEADER)
+YODA_footer=$(doxyval "$doxyfile" HTML_FOOTER)
+YODA_projectname=$(doxyval "$doxyfile" PROJECT_NAME)
+YODA_projectnumber=$(doxyval "$doxyfile" PROJECT_NUMBER)
+YODA_projectbrief=$(doxyval "$doxyfile" PROJECT_BRIEF)
+YODA_projectlogo=$(doxyval "$doxyfile" PROJECT_LOGO)
+YODA_projectlogo=${YODA_projectlogo:+$(basename "$YODA_projectlogo")}
+YODA_stylesheets=
+for css in $(doxyval "$doxyfile" HTML_EXTRA_STYLESHEET); do
+  YODA_stylesheets="$YODA_stylesheets $(basename "$css")"
+done
+YODA_doxygenversion=$(sed -n 's/.*<meta name="generator" content="Doxygen \([^"]*\)".*/\1/p' "$html/index.html")
+[ -n "$YODA_doxygenversion" ] || YODA_doxygenversion=$(doxygen --version)
+
+yes() {
+  case $(doxyval "$doxyfile" "$1") in
+    YES) YODA_flags="$YODA_flags $1" ;;
+  esac
+}
+YODA_flags=
+[ -n "$YODA_projectname" ] && YODA_flags="$YODA_flags PROJECT_NAME"
+[ -n "$YODA_projectnumber" ] && YODA_flags="$YODA_flags PROJECT_NUMBER"
+[ -n "$YODA_projectbrief" ] && YODA_flags="$YODA_flags PROJECT_BRIEF"
+[ -n "$YODA_projectlogo" ] && YODA_flags="$YODA_flags PROJECT_LOGO"
+[ -n "$YODA_flags" ] && YODA_flags="$YODA_flags TITLEAREA"
+yes GENERATE_TREEVIEW
+yes DISABLE_INDEX
+yes FULL_SIDEBAR
+# On unless turned off
+[ "$(doxyval "$doxyfile" SEARCHENGINE)" = NO ] || YODA_flags="$YODA_flags SEARCHENGINE"
+
+export YODA_root YODA_header YODA_footer YODA_projectname YODA_projectnumber \
+  YODA_projectbrief YODA_projectlogo YODA_stylesheets YODA_doxygenversion YODA_flags
+find "$html" -name '*.html' | xargs -P "$jobs" -n 512 awk -f "$here/template.awk" -f "$here/reTemplate.awk"
+echo "Re-templated $(find "$html" -name '*.html' | wc -l) pages"
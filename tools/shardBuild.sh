@@ -0,0 +1,232 @@
+#!/usr/bin/env sh
+
+# Splits INPUT over several doxygen runs which go in parallel, then links
+# them up into one site. Each shard is built with the theme settings of
+# the given Doxyfile and TAGFILES pointing at the other shards. A final
+# run over all the tag files builds the top level class, namespace and
+# file lists and indexes, which link into the shards. The shards' search
+# data is merged into one search for the whole site, and the pages of the
+# shards are pointed at it and at the top level menu.
+# Usage: shardBuild.sh <Doxyfile> [shards] [output dir]
+doxyfile=${1:?"Usage: $0 <Doxyfile> [shards] [output dir]"}
+shards=${2:-$(nproc 2>/dev/null || echo 4)}
+here=$(cd "$(dirname "$0")" && pwd)
+. "$here/config.sh"
+jobs=$(nproc 2>/dev/null || echo 4)
+cd "$(dirname "$doxyfile")" || exit 1
+doxyfile=$(pwd)/$(basename "$doxyfile")
+mkdir -p "${3:-shards}"
+out=$(cd "${3:-shards}" && pwd)
+rm -rf "$out/tags" "$out/html"
+mkdir -p "$out/tags" "$out/html"
+
+# Directories are split into units of work, each a directory without the
+# subdirectories which are units of their own, so doxygen still applies
+# FILE_PATTERNS, EXCLUDE_PATTERNS and RECURSIVE to everything. Files given
+# in INPUT stay as they are. Units go to the least loaded shard, heaviest
+# first, one line each of
+#   shard TAB path TAB the unit it was split off from
+awk '
+  /^[ \t]*INPUT[ \t]*=/ { input = ""; sub(/^[^=]*=/, ""); grab = 1 }
+  /^[ \t]*INPUT[ \t]*\+=/ { sub(/^[^=]*=/, ""); grab = 1 }
+  grab {
+    more = sub(/\\[ \t]*$/, "")
+    input = input " " $0
+    grab = more
+  }
+  END { print input }
+' "$doxyfile" | xargs -n 1 | sed '/^$/d' > "$out/input"
+[ -s "$out/input" ] || { echo "INPUT is empty in $doxyfile, list the directories to split" >&2; exit 1; }
+recursive=$(doxyval "$doxyfile" RECURSIVE)
+while IFS= read -r path; do
+  if [ ! -e "$path" ]; then
+    echo "No such INPUT: $path" >&2
+  elif [ -d "$path" ] && [ "$recursive" = YES ]; then
+    # Each directory on its own, without its subdirectories
+    du -k -S "$path" | sed 's|/*$||'
+  else
+    du -s -k "$path" | sed 's|/*$||'
+  fi
+done < "$out/input" | awk -F '\t' -v shards="$shards" -v exclude="$(doxyval "$doxyfile" EXCLUDE)" \
+  -v patterns="$(doxyval "$doxyfile" EXCLUDE_PATTERNS)" '
+  function glob(s) {
+    gsub(/[.+^$(){}|\[\]]/, "\\\\&", s)
+    gsub(/\*/, ".*", s)
+    gsub(/\?/, ".", s)
+    return "^" s "$"
+  }
+  # Directories doxygen skips anyway stay with their parent
+  function skipped(path, name, i) {
+    name = path
+    sub(/.*\//, "", name)
+    sub(/^\.\//, "", path)
+    if (name ~ /^\./ || path in excluded) return 1
+    for (i = 1; i <= npatterns; i++) if (path ~ pattern[i] || path "/" ~ pattern[i] || name ~ pattern[i]) return 1
+    return 0
+  }
+  function parent(path) {
+    return sub(/\/[^\/]*$/, "", path) ? path : ""
+  }
+  # Children big enough to be units of their own are split off, the rest
+  # stays with the unit
+  function split_off(path, from, i, n, list) {
+    size[path] = total[path]
+    n = split(kids[path], list, "\n") - 1
+    if (total[path] > limit) {
+      for (i = 1; i <= n; i++) {
+        if (total[list[i]] * 4 > limit && !skipped(list[i])) {
+          size[path] -= total[list[i]]
+          split_off(list[i], path)
+        }
+      }
+    }
+    unit[++units] = path
+    from_unit[path] = from
+  }
+  BEGIN {
+    n = split(exclude, t, " ")
+    for (i = 1; i <= n; i++) { sub(/\/+$/, "", t[i]); sub(/^\.\//, "", t[i]); excluded[t[i]] = 1 }
+    npatterns = split(patterns, t, " ")
+    for (i = 1; i <= npatterns; i++) pattern[i] = glob(t[i])
+  }
+  {
+    path = $2
+    # du lists subdirectories before their parents
+    total[path] = $1 + below[path]
+    below[parent(path)] += total[path]
+    kids[parent(path)] = kids[parent(path)] path "\n"
+    if (!(path in order)) order[path] = ++paths
+    grand += $1
+  }
+  END {
+    limit = grand / (shards * 4)
+    for (path in order) if (!((parent(path)) in order)) root[order[path]] = path
+    for (i = 1; i <= paths; i++) if (i in root) split_off(root[i], "")
+    for (i = 1; i <= shards; i++) load[i] = 0
+    # Heaviest first, each to the least loaded shard
+    for (i = 1; i <= units; i++) {
+      for (j = i + 1; j <= units; j++) {
+        if (size[unit[j]] > size[unit[i]]) { t0 = unit[i]; unit[i] = unit[j]; unit[j] = t0 }
+      }
+      best = 1
+      for (j = 2; j <= shards; j++) if (load[j] < load[best]) best = j
+      load[best] += size[unit[i]] + 1
+      print best "\t" unit[i] "\t" from_unit[unit[i]]
+    }
+  }
+' > "$out/units"
+rm -f "$out/input"
+[ -s "$out/units" ] || { echo "Nothing to build in INPUT of $doxyfile" >&2; exit 1; }
+
+# A shard reads its units, except those split off one of its other units,
+# and leaves out the units of other shards which were split off its own
+shardInput() {
+  awk -F '\t' -v shard="$1" '
+    { unit[$2] = $1; from[$2] = $3 }
+    END {
+      print "INPUT = \\"
+      for (path in unit) if (unit[path] == shard && (from[path] == "" || unit[from[path]] != shard)) print "\"" path "\" \\"
+      print ""
+      print "EXCLUDE += \\"
+      for (path in unit) if (unit[path] != shard && from[path] != "" && unit[from[path]] == shard) print "\"" path "\" \\"
+      print ""
+    }
+  ' "$out/units"
+}
+
+# Same settings, other INPUT and output
+config() {
+  echo "@INCLUDE = \"$doxyfile\""
+  echo "OUTPUT_DIRECTORY = \"$out\""
+  echo "GENERATE_LATEX = NO"
+  echo "GENERATE_XML = NO"
+  printf '%s\n' "$@"
+}
+
+list=$(cut -f1 "$out/units" | sort -un)
+for n in $list; do
+  { config "GENERATE_HTML = NO" "HAVE_DOT = NO" "GENERATE_TAGFILE = \"$out/tags/shard$n.tag\""
+    shardInput "$n"; } > "$out/shard$n.tags.cfg"
+  doxygen "$out/shard$n.tags.cfg" > "$out/shard$n.log" 2>&1 &
+done
+wait
+echo "Tagged $(ls "$out"/tags | wc -l) shards"
+
+for n in $list; do
+  { config "HTML_OUTPUT = html/shard$n" "GENERATE_TAGFILE ="
+    echo "TAGFILES = \\"
+    for tag in "$out"/tags/*.tag; do
+      [ -f "$tag" ] || continue
+      other=$(basename "$tag" .tag)
+      [ "$other" = "shard$n" ] || echo "\"$tag=../$other\" \\"
+    done
+    echo
+    shardInput "$n"; } > "$out/shard$n.cfg"
+  doxygen "$out/shard$n.cfg" >> "$out/shard$n.log" 2>&1 &
+done
+wait
+echo "Built $(ls -d "$out"/html/shard* | wc -l) shards"
+
+# An empty INPUT would mean the current directory
+: > "$out/top.dox"
+{ config "HTML_OUTPUT = html" "INPUT = \"$out/top.dox\"" "USE_MDFILE_AS_MAINPAGE =" "ALLEXTERNALS = YES" \
+    "EXTERNAL_GROUPS = YES" "EXTERNAL_PAGES = YES"
+  echo "TAGFILES = \\"
+  for tag in "$out"/tags/*.tag; do
+    [ -f "$tag" ] || continue
+    echo "\"$tag=$(basename "$tag" .tag)\" \\"
+  done
+  echo; } > "$out/top.cfg"
+doxygen "$out/top.cfg" > "$out/top.log" 2>&1
+
+# One search over every shard, in the top level search directory
+search=$out/html/search
+if [ -f "$search/searchdata.js" ]; then
+  set -- "$search" ""
+  for n in $list; do
+    [ -f "$out/html/shard$n/search/searchdata.js" ] && set -- "$@" "$out/html/shard$n/search" "shard$n"
+  done
+  rm -f "$out/search.page"
+  awk -v searchdata="$out/searchdata.js" -v template="$out/search.page" -f "$here/mergeSearch.awk" "$@" |
+    LC_ALL=C sort -t "$(printf '\t')" -k1,1 -k2,2 -k3,3 > "$out/search.entries"
+  rm -f "$search"/*_[0-9]*.js "$search"/*_[0-9]*.html
+  mv "$out/searchdata.js" "$search/searchdata.js"
+  page=
+  [ -f "$out/search.page" ] && page=$out/search.page
+  awk -F '\t' -v dir="$search" -v page="$page" -v q="'" '
+    BEGIN { if (page != "") while ((getline line < page) > 0) html = html line "\n" }
+    function finish() {
+      if (file == "") return
+      printf "\n];\n" > file
+      close(file)
+    }
+    $1 != name {
+      finish()
+      name = $1
+      file = dir "/" name ".js"
+      printf "var searchData=\n[\n" > file
+      n = 0
+      # The per letter page of this file, where doxygen writes them
+      if (html != "") {
+        text = html
+        gsub(/[a-z]+_[0-9]+\.js/, name ".js", text)
+        printf "%s", text > (dir "/" name ".html")
+        close(dir "/" name ".html")
+      }
+    }
+    { printf "%s  [%s%s_%d%s,%s]", n ? ",\n" : "", q, $3, n++, q, $4 > file }
+    END { finish() }
+  ' "$out/search.entries"
+  rm -f "$out/search.entries" "$out/search.page"
+  for n in $list; do rm -rf "$out/html/shard$n/search"; done
+fi
+
+# The shards' pages use the top level search and menu (the tabs), one
+# directory up from their own
+cat > "$out/pages.sed" <<'EOF'
+s#(["'])((\.\./)*)(search[/"']|menudata\.js)#\1\2../\4#g
+s#initMenu\('((\.\./)*)#initMenu('\1../#
+EOF
+find "$out"/html/shard* -name '*.html' -print0 | xargs -0 -n 256 -P "$jobs" sed -i -E -f "$out/pages.sed"
+rm -f "$out/pages.sed"
+echo "Done, see $out/html/index.html"
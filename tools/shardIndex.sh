@@ -0,0 +1,65 @@
+#!/usr/bin/env sh
+
+# Shards the class, namespace and file member indexes into pages which
+# are streamed in (see src/js/indexStream.js) as the reader scrolls.
+# Run over the html output after doxygen.
+html=${1:?"Usage: $0 <html dir> [entries per page]"}
+size=${2:-200}
+here=$(dirname "$0")
+js="$here/../src/js/indexStream.js"
+[ -f "$js" ] || js="$here/../js/indexStream.js"
+
+count=0
+for page in "$html"/functions*.html "$html"/namespacemembers*.html "$html"/globals*.html; do
+  [ -f "$page" ] || continue
+  # Already sharded
+  grep -q 'class="index-more"' "$page" && continue
+  base=$(basename "$page" .html)
+  awk -v size="$size" -v dir="$html" -v base="$base" '
+    function esc(s) {
+      # "&&" doubles the backslash in every awk, "\\\\" only in some
+      gsub(/\\/, "&&", s)
+      gsub(/"/, "\\\"", s)
+      gsub(/\t/, "\\t", s)
+      gsub(/\r/, "", s)
+      return s
+    }
+    function add(s) {
+      buf = buf (buf == "" ? "" : ",\n") "\"" esc(s) "\""
+    }
+    function flush() {
+      if (buf == "") return
+      file = dir "/" base "." ++chunks ".json"
+      printf "[%s]\n", buf > file
+      close(file)
+      buf = ""
+      m = 0
+    }
+    tail { rest = rest $0 "\n"; next }
+    /<!-- contents -->/ && spill { tail = 1; rest = $0 "\n"; next }
+    /<div class="contents">/ { inside = 1 }
+    !inside { print; next }
+    !spill {
+      print
+      if ($0 ~ /<\/li>/ && ++n >= size) { spill = 1; print "</ul>" }
+      next
+    }
+    # Everything past the first page goes to the chunks
+    /<h3>/ { line = $0; sub(/<ul>[ \t]*$/, "", line); add(line); next }
+    /<li>/ { item = $0 }
+    /<li>/, /<\/li>/ {
+      if ($0 !~ /<li>/) item = item " " $0
+      if ($0 ~ /<\/li>/) { add(item); if (++m >= size) flush() }
+    }
+    END {
+      if (!spill) exit
+      flush()
+      printf "<div class=\"index-more\" data-base=\"%s\" data-chunks=\"%d\"></div>\n", base, chunks
+      printf "<script type=\"text/javascript\" src=\"indexStream.js\" defer></script>\n"
+      printf "%s", rest
+    }
+  ' "$page" > "$page.tmp" && mv "$page.tmp" "$page"
+  grep -q 'class="index-more"' "$page" && count=$((count + 1))
+done
+cp "$js" "$html"
+echo "Sharded $count index pages"
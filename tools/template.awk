@@ -0,0 +1,49 @@
+# Expands doxygen's HTML_HEADER and HTML_FOOTER templates. Blocks between
+# <!--BEGIN NAME--> and <!--END NAME--> are kept when NAME is one of the
+# space separated "flags" (or is missing from them, for !NAME) and each
+# $token is replaced by tok["token"]. Used by the tools which write pages
+# outside of doxygen.
+
+function replace(s, from, to,    out, i) {
+  out = ""
+  while ((i = index(s, from)) > 0) {
+    out = out substr(s, 1, i - 1) to
+    s = substr(s, i + length(from))
+  }
+  return out s
+}
+
+function enabled(name) {
+  if (substr(name, 1, 1) == "!") return !enabled(substr(name, 2))
+  return index(" " flags " ", " " name " ") > 0
+}
+
+function slurp(file,    line, text) {
+  text = ""
+  while ((getline line < file) > 0) text = text line "\n"
+  close(file)
+  return text
+}
+
+function expand(text,    name, head, rest, end, i, t) {
+  while (match(text, /<!--BEGIN !?[A-Z_]+-->/)) {
+    name = substr(text, RSTART + 10, RLENGTH - 13)
+    head = substr(text, 1, RSTART - 1)
+    rest = substr(text, RSTART + RLENGTH)
+    end = "<!--END " name "-->"
+    if (!(i = index(rest, end))) {
+      text = head rest
+      continue
+    }
+    text = head (enabled(name) ? substr(rest, 1, i - 1) : "") substr(rest, i + length(end))
+  }
+  # Longest first, so $datetime isn't taken for $date
+  text = replace(text, "$relpath^", tok["relpath"])
+  text = replace(text, "$relpath$", tok["relpath"])
+  text = replace(text, "$datetime", tok["datetime"])
+  split("title projectname projectnumber projectbrief projectlogo doxygenversion " \
+        "generatedby extrastylesheet stylesheet treeview search navpath mathjax " \
+        "date year langISO", t)
+  for (i = 1; i in t; i++) text = replace(text, "$" t[i], tok[t[i]])
+  return text
+}
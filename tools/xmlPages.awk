@@ -0,0 +1,44 @@
+# Puts the themed header and footer around the page bodies rendered by
+# src/xslt/doxyYoda.xsl. Each .body file given is written out as .html,
+# with the values for the template taken from the YODA_* environment
+# set by tools/xmlSite.sh, and the tabs from $YODA_tabs under the header.
+# Needs tools/template.awk.
+
+function escape(s) {
+  gsub(/&/, "\\&amp;", s)
+  gsub(/</, "\\&lt;", s)
+  gsub(/>/, "\\&gt;", s)
+  return s
+}
+
+function finish() {
+  # Doxygen closes the #top div the header opens after its menus
+  printf "%s%s</div><!-- top -->\n%s%s", replace(header, "\001", escape(title)), tabs, body, footer > out
+  close(out)
+}
+
+BEGIN {
+  split("projectname projectnumber projectbrief projectlogo doxygenversion extrastylesheet", t)
+  for (i = 1; i in t; i++) tok[t[i]] = ENVIRON["YODA_" t[i]]
+  tok["generatedby"] = "Generated by"
+  tok["title"] = "\001"
+  flags = ENVIRON["YODA_flags"]
+  header = expand(slurp(ENVIRON["YODA_header"]))
+  footer = expand(slurp(ENVIRON["YODA_footer"]))
+  if (ENVIRON["YODA_tabs"] != "") tabs = slurp(ENVIRON["YODA_tabs"])
+}
+
+FNR == 1 {
+  if (out) finish()
+  out = FILENAME
+  sub(/\.body$/, ".html", out)
+  title = $0
+  sub(/^<!--title:/, "", title)
+  sub(/-->$/, "", title)
+  body = ""
+  next
+}
+
+{ body = body $0 "\n" }
+
+END { if (out) finish() }
@@ -0,0 +1,75 @@
+#!/usr/bin/env sh
+
+# Builds a lean themed site straight from doxygen's XML output
+# (GENERATE_XML = YES) instead of its HTML writer. The compounds are
+# rendered by src/xslt/doxyYoda.xsl, one xsltproc per core each taking its
+# share of index.xml, and then wrapped in the theme's header, the tabs of
+# the layout's navindex and the footer.
+# Usage: xmlSite.sh <xml dir> <output dir> [Doxyfile]
+xml=${1:?"Usage: $0 <xml dir> <output dir> [Doxyfile]"}
+out=${2:?"Usage: $0 <xml dir> <output dir> [Doxyfile]"}
+doxyfile=$3
+here=$(cd "$(dirname "$0")" && pwd)
+. "$here/config.sh"
+src=$here/../src
+[ -d "$src" ] || src=$here/..
+jobs=$(nproc 2>/dev/null || echo 4)
+mkdir -p "$out"
+out=$(cd "$out" && pwd)
+
+YODA_header=$src/html/header.html
+YODA_footer=$src/html/footer.html
+stylesheets=
+if [ -n "$doxyfile" ]; then
+  YODA_projectname=$(doxyval "$doxyfile" PROJECT_NAME)
+  YODA_projectnumber=$(doxyval "$doxyfile" PROJECT_NUMBER)
+  YODA_projectbrief=$(doxyval "$doxyfile" PROJECT_BRIEF)
+  YODA_projectlogo=$(doxyval "$doxyfile" PROJECT_LOGO)
+  stylesheets=$(doxyval "$doxyfile" HTML_EXTRA_STYLESHEET)
+  header=$(doxyval "$doxyfile" HTML_HEADER)
+  footer=$(doxyval "$doxyfile" HTML_FOOTER)
+  [ -n "$header" ] && YODA_header=$header
+  [ -n "$footer" ] && YODA_footer=$footer
+fi
+[ -n "$stylesheets" ] || stylesheets=$(ls "$src"/styles/doxyYoda.css "$src"/css/doxyYoda.min.css 2>/dev/null)
+YODA_extrastylesheet=
+for css in $stylesheets; do
+  cp "$css" "$out"
+  YODA_extrastylesheet="$YODA_extrastylesheet<link href=\"$(basename "$css")\" rel=\"stylesheet\" type=\"text/css\"/>
+"
+done
+if [ -n "$YODA_projectlogo" ]; then
+  cp "$YODA_projectlogo" "$out"
+  YODA_projectlogo=$(basename "$YODA_projectlogo")
+fi
+YODA_doxygenversion=$(sed -n 's/.*<doxygenindex[^>]*version="\([^"]*\)".*/\1/p' "$xml/index.xml")
+
+YODA_flags=
+[ -n "$YODA_projectname" ] && YODA_flags="$YODA_flags PROJECT_NAME"
+[ -n "$YODA_projectnumber" ] && YODA_flags="$YODA_flags PROJECT_NUMBER"
+[ -n "$YODA_projectbrief" ] && YODA_flags="$YODA_flags PROJECT_BRIEF"
+[ -n "$YODA_projectlogo" ] && YODA_flags="$YODA_flags PROJECT_LOGO"
+[ -n "$YODA_flags" ] && YODA_flags="$YODA_flags TITLEAREA"
+
+# None of doxygen's own scripts and styles are written out here
+sed '/tabs\.css\|jquery\.js\|dynsections\.js/d' "$YODA_header" > "$out/.header.html"
+YODA_header=$out/.header.html
+export YODA_header YODA_footer YODA_flags YODA_projectname YODA_projectnumber \
+  YODA_projectbrief YODA_projectlogo YODA_doxygenversion YODA_extrastylesheet
+
+seq 0 $((jobs - 1)) |
+  xargs -P "$jobs" -I{} xsltproc --stringparam layout "$src/xml/doxyYoda.xml" --stringparam out "$out/" \
+    --param shard {} --param shards "$jobs" "$src/xslt/doxyYoda.xsl" "$xml/index.xml"
+mv "$out/tabs.body" "$out/.tabs.html"
+YODA_tabs=$out/.tabs.html
+export YODA_tabs
+
+find "$out" -name '*.body' | xargs -P "$jobs" -n 256 awk -f "$here/template.awk" -f "$here/xmlPages.awk"
+find "$out" -name '*.body' -exec rm -f {} +
+rm -f "$YODA_header" "$YODA_tabs"
+if [ -f "$out/indexpage.html" ]; then
+  cp "$out/indexpage.html" "$out/index.html"
+else
+  cp "$out/annotated.html" "$out/index.html"
+fi
+echo "Wrote $(ls "$out"/*.html | wc -l) pages to $out"
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+# Copyright 2020 Rohit Goswami <rog32@hi.is>
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Serves a site packed by tools/mkArchive.sh straight out of the zip.
+
+Deflated entries go out to clients which accept gzip without being
+inflated: a gzip header is written, the raw deflate stream is sent from
+the archive with sendfile and the CRC and length from the zip index make
+up the trailer. Everything else is inflated on the way out.
+
+Usage: zipServe.py <archive.zip> [port]
+"""
+
+import mimetypes
+import mmap
+import os
+import struct
+import sys
+import zipfile
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import unquote, urlsplit
+
+GZIP_HEADER = b"\x1f\x8b\x08\x00\x00\x00\x00\x00\x00\xff"
+
+
+class Archive:
+    def __init__(self, path):
+        self.file = open(path, "rb")
+        self.map = mmap.mmap(self.file.fileno(), 0, access=mmap.ACCESS_READ)
+        self.zip = zipfile.ZipFile(self.file)
+        self.entries = {info.filename: info for info in self.zip.infolist()}
+
+    def data_offset(self, info):
+        # The local header repeats the name and has its own extra field
+        name, extra = struct.unpack_from("<HH", self.map, info.header_offset + 26)
+        return info.header_offset + 30 + name + extra
+
+    def find(self, path):
+        path = path.lstrip("/")
+        if path == "" or path.endswith("/"):
+            path += "index.html"
+        return self.entries.get(path)
+
+
+class Handler(BaseHTTPRequestHandler):
+    archive = None
+
+    def do_HEAD(self):
+        self.serve(body=False)
+
+    def do_GET(self):
+        self.serve(body=True)
+
+    def serve(self, body):
+        info = self.archive.find(unquote(urlsplit(self.path).path))
+        if info is None:
+            self.send_error(404)
+            return
+        kind = mimetypes.guess_type(info.filename)[0] or "application/octet-stream"
+        gzip = (info.compress_type == zipfile.ZIP_DEFLATED
+                and "gzip" in self.headers.get("Accept-Encoding", ""))
+        stored = info.compress_type == zipfile.ZIP_STORED
+        # The CRC of the contents, the gzip body is a different
+        # representation and gets its own tag
+        etag = '"%08x%s"' % (info.CRC, "-gzip" if gzip else "")
+        if self.not_modified(etag):
+            self.send_response(304)
+            self.send_header("ETag", etag)
+            self.send_header("Vary", "Accept-Encoding")
+            self.end_headers()
+            return
+        self.send_response(200)
+        self.send_header("Content-Type", kind)
+        self.send_header("ETag", etag)
+        if gzip:
+            self.send_header("Content-Encoding", "gzip")
+            self.send_header("Content-Length", str(info.compress_size + 18))
+        else:
+            self.send_header("Content-Length", str(info.file_size))
+        self.send_header("Vary", "Accept-Encoding")
+        self.end_headers()
+        if not body:
+            return
+        if gzip or stored:
+            if gzip:
+                self.wfile.write(GZIP_HEADER)
+            self.wfile.flush()
+            offset = self.archive.data_offset(info)
+            left = info.compress_size
+            while left > 0:
+                sent = os.sendfile(self.connection.fileno(), self.archive.file.fileno(), offset, left)
+                if sent == 0:
+                    break
+                offset += sent
+                left -= sent
+            if gzip:
+                self.wfile.write(struct.pack("<II", info.CRC, info.file_size & 0xFFFFFFFF))
+        else:
+            self.wfile.write(self.archive.zip.read(info))
+
+    def not_modified(self, etag):
+        match = self.headers.get("If-None-Match")
+        if match is None:
+            return False
+        # Weak comparison, as If-None-Match asks for
+        tags = [tag.strip() for tag in match.split(",")]
+        return "*" in tags or etag in [tag[2:] if tag.startswith("W/") else tag for tag in tags]
+
+    def log_message(self, format, *args):
+        pass
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit(__doc__.strip().splitlines()[-1])
+    Handler.archive = Archive(sys.argv[1])
+    port = int(sys.argv[2]) if len(sys.argv) > 2 else 8080
+    server = ThreadingHTTPServer(("", port), Handler)
+    print("Serving %d files from %s on http://localhost:%d"
+          % (len(Handler.archive.entries), sys.argv[1], port))
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()